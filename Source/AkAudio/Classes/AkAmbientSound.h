@@ -90,6 +90,23 @@ public:
 	 */
 	bool IsCurrentlyPlaying();
 
+	/**
+	 * Stop the looping event because no listener can hear it, and unregister the game object unless other events
+	 * play on it. The ambient sound is still considered playing. See FAkAmbientVirtualizer.
+	 */
+	void Virtualize();
+
+	/**
+	 * Post the event of a virtualized ambient sound again, seeking to where the loop would be if enabled
+	 */
+	void RestartFromVirtual();
+
+	/** Whether the event is stopped because no listener can hear it */
+	bool IsVirtual() const
+	{
+		return bVirtual;
+	}
+
 
 protected:
 	/*------------------------------------------------------------------------------------
@@ -109,8 +126,32 @@ protected:
 #endif
 
 private:
-	/** used to update status of toggleable level placed ambient sounds on clients */
+	friend class FAkAmbientVirtualizer;
+
+	/** Post the event of the AkComponent on this ambient sound, and let the virtualizer check it if it loops */
+	bool PostAmbientEvent();
+
+	/** Called on the game thread for the notifications of the ambience's event */
+	void HandleAkCallback( const struct FAkCallbackPayload& in_Payload );
+
+	/** Playing ID of the event last posted. Notifications of other instances, such as one stopped by virtualization, are ignored. */
+	uint32 PlayingID;
+
+	/** Whether the event is stopped because no listener can hear it */
+	bool bVirtual;
+
+	/** Duration of one iteration of the loop, in seconds, as notified by the sound engine. 0 if unknown. */
+	float LoopDuration;
+
+	/** World time at which the ambience was started, from which restarted loops seek */
+	float PlayStartTime;
+
+	/** Index of this ambient sound in the virtualizer, or INDEX_NONE */
+	int32 VirtualizerSlot;
+
+	/** used to update status of toggleable level placed ambient sounds on clients. Only used from the game thread. */
 	bool CurrentlyPlaying;
 
-	FCriticalSection PlayingCriticalSection;
+	/** Cookie of this ambient sound's handler in the callback dispatcher, registered on first use */
+	void * CallbackCookie;
 };
@@ -0,0 +1,44 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkAmbientVolume.h:
+=============================================================================*/
+#pragma once
+
+#include "AkAmbientVolume.generated.h"
+
+/*------------------------------------------------------------------------------------
+	AAkAmbientVolume
+------------------------------------------------------------------------------------*/
+/**
+ * Ambience filling a brush: it is heard from the point of the brush closest to the listener,
+ * and from the listener's own position inside the brush. Replaces the grids of ambient sounds
+ * used for forests, machine rooms and other areas.
+ */
+UCLASS(hidecategories=(Advanced, Attachment, Volume), BlueprintType)
+class AKAUDIO_API AAkAmbientVolume : public AVolume
+{
+	GENERATED_UCLASS_BODY()
+
+	/** AkComponent playing the ambience from the brush */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category=AkAmbientVolume, meta=(ShowOnlyInnerProperties))
+	class UAkVolumeEmitterComponent * AkComponent;
+
+	/** Start playing the event of the AkComponent when the game starts */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=AkAmbientVolume)
+	bool bAutoPlay;
+
+	/*
+	 * Start the ambience, unless it is already playing.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkAmbientVolume")
+	void StartAmbientSound();
+
+	/*
+	 * Stop the ambience.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkAmbientVolume")
+	void StopAmbientSound();
+
+	virtual void BeginPlay() override;
+};
@@ -7,6 +7,38 @@
 
 #include "AkAudioEvent.generated.h"
 
+/** What to do when an event is posted while it already plays as many instances as it is allowed to */
+UENUM()
+namespace EAkConcurrencyStealPolicy
+{
+	enum Type
+	{
+		/** Do not post the new instance */
+		None,
+		/** Stop the instance that was posted first */
+		Oldest,
+		/** Stop the instance farthest from the listeners, relative to its emitter's attenuation scaling factor */
+		Quietest,
+		/** Stop the instance farthest from the listeners */
+		Farthest,
+	};
+}
+
+/** Whether an event ends on its own */
+UENUM()
+namespace EAkEventPlaybackType
+{
+	enum Type
+	{
+		/** Not classified: the event is treated as possibly looping, but is not virtualized */
+		Unknown,
+		/** Every sound of the event ends on its own */
+		OneShot,
+		/** The event plays a looping or infinite sound */
+		Looping,
+	};
+}
+
 /*------------------------------------------------------------------------------------
 	UAkAudioEvent
 ------------------------------------------------------------------------------------*/
@@ -24,18 +56,74 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category="AkAudioEvent")
 	float MaxAttenuationRadius;
 
+	/** Whether this event plays a looping or infinite sound. Only one-shot events are culled before being posted, since the emitter of the others may come in range while they play. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AkAudioEvent")
+	TEnumAsByte<EAkEventPlaybackType::Type> PlaybackType;
+
+	/** Maximum number of instances of this event playing at once, on all game objects. 0 means no limit. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Concurrency", meta=(ClampMin=0))
+	int32 MaxInstances;
+
+	/** Maximum number of instances of this event playing at once on the same game object. 0 means no limit. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Concurrency", meta=(ClampMin=0))
+	int32 MaxInstancesPerGameObject;
+
+	/** Posts of this event on the same game object (or at a location) closer than this many seconds of game time to the previous one are dropped */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Concurrency", meta=(ClampMin=0.0))
+	float MinRetriggerInterval;
+
+	/** What to do when the event is posted while at one of its instance limits */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Concurrency")
+	TEnumAsByte<EAkConcurrencyStealPolicy::Type> StealPolicy;
+
+	/** Whether this event is known to play a looping or infinite sound */
+	bool IsLooping() const
+	{
+		return PlaybackType == EAkEventPlaybackType::Looping;
+	}
+
+	/** Whether this event is known to end on its own */
+	bool IsOneShot() const
+	{
+		return PlaybackType == EAkEventPlaybackType::OneShot;
+	}
+
+	/** Whether posts of this event are subject to concurrency rules */
+	bool HasConcurrencyRules() const
+	{
+		return MaxInstances > 0 || MaxInstancesPerGameObject > 0 || MinRetriggerInterval > 0.0f;
+	}
+
 #if CPP
 	/**
 	 * Called after load process is complete.
 	 */
 	virtual void PostLoad() override;
 
+	/**
+	 * Called after the event has been renamed, so that the cached ID follows the new name.
+	 */
+	virtual void PostRename(UObject* OldOuter, const FName OldName) override;
+
+	/** Get the Wwise ID of this event, hashed from its name when the event is loaded */
+	AkUniqueID GetEventId() const
+	{
+		return EventId;
+	}
+
 	/**
 	 * Load the required bank.
 	 *
 	 * @return true if the bank was loaded, otherwise false
 	 */
 	bool LoadBank();
+
+private:
+	/** Refresh the cached Wwise ID from the current name of the event */
+	void UpdateEventId();
+
+	/** Cached Wwise ID of this event, so posting does not have to hash the name every time */
+	AkUniqueID EventId;
 #endif
 
 };
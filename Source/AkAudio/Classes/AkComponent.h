@@ -8,6 +8,105 @@
 
 #include "AkComponent.generated.h"
 
+/*------------------------------------------------------------------------------------
+	FAkPlayingHandle
+------------------------------------------------------------------------------------*/
+/** Reference to an event posted on an AkComponent. Stays valid (and inert) once the event has ended. */
+USTRUCT(BlueprintType)
+struct FAkPlayingHandle
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Playing ID assigned by the sound engine, or 0 if the event could not be posted */
+	UPROPERTY(BlueprintReadOnly, Category="Audiokinetic|AkComponent")
+	int32 PlayingID;
+
+	UPROPERTY()
+	int32 SlotIndex;
+
+	UPROPERTY()
+	int32 Generation;
+
+	FAkPlayingHandle()
+		: PlayingID(0)
+		, SlotIndex(0)
+		, Generation(0)
+	{}
+};
+
+/*------------------------------------------------------------------------------------
+	FAkEventCallbackInfo
+------------------------------------------------------------------------------------*/
+/** Kind of notification received for an event posted on an AkComponent */
+UENUM(BlueprintType)
+namespace EAkCallbackType
+{
+	enum Type
+	{
+		EndOfEvent,
+		Marker,
+		Duration,
+		MusicSyncBeat,
+		MusicSyncBar,
+		MusicSyncEntry,
+		MusicSyncExit,
+		MusicSyncGrid,
+		MusicSyncUserCue,
+		MusicSyncPoint,
+		Other,
+	};
+}
+
+/** Notification received for an event posted on an AkComponent. Only the fields relevant to its type are set. */
+USTRUCT(BlueprintType)
+struct FAkEventCallbackInfo
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Audiokinetic|AkComponent")
+	TEnumAsByte<EAkCallbackType::Type> CallbackType;
+
+	UPROPERTY(BlueprintReadOnly, Category="Audiokinetic|AkComponent")
+	int32 PlayingID;
+
+	/** Cue identifier of a marker */
+	UPROPERTY(BlueprintReadOnly, Category="Audiokinetic|AkComponent")
+	int32 MarkerIdentifier;
+
+	/** Position of a marker, in samples */
+	UPROPERTY(BlueprintReadOnly, Category="Audiokinetic|AkComponent")
+	int32 MarkerPosition;
+
+	/** Duration of the sound that started playing, in ms */
+	UPROPERTY(BlueprintReadOnly, Category="Audiokinetic|AkComponent")
+	float Duration;
+
+	/** Estimated duration of the sound that started playing, pitch included, in ms */
+	UPROPERTY(BlueprintReadOnly, Category="Audiokinetic|AkComponent")
+	float EstimatedDuration;
+
+	/** Beat duration of the current music segment, in seconds */
+	UPROPERTY(BlueprintReadOnly, Category="Audiokinetic|AkComponent")
+	float BeatDuration;
+
+	/** Bar duration of the current music segment, in seconds */
+	UPROPERTY(BlueprintReadOnly, Category="Audiokinetic|AkComponent")
+	float BarDuration;
+
+	FAkEventCallbackInfo()
+		: CallbackType(EAkCallbackType::Other)
+		, PlayingID(0)
+		, MarkerIdentifier(0)
+		, MarkerPosition(0)
+		, Duration(0.0f)
+		, EstimatedDuration(0.0f)
+		, BeatDuration(0.0f)
+		, BarDuration(0.0f)
+	{}
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam( FOnAkEventCallback, const FAkEventCallbackInfo&, CallbackInfo );
+
 /*------------------------------------------------------------------------------------
 	UAkComponent
 ------------------------------------------------------------------------------------*/
@@ -50,6 +149,55 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkComponent")
 	void Stop();
+
+	/**
+	 * Posts an event to Wwise, using this component as the game object source, and returns a handle to it
+	 *
+	 * @param AkEvent		The event to post
+	 * @return				Handle that can be used to stop or query this instance of the event
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkComponent", meta = (AdvancedDisplay = "1"))
+	FAkPlayingHandle PostAkEventWithHandle( class UAkAudioEvent * AkEvent, const FString& in_EventName );
+
+	/**
+	 * Posts an event to Wwise, using this component as the game object source, and requests notifications
+	 * for it. Notifications are broadcast through OnAkEventCallback on the game thread, along with the
+	 * end of every event posted on this component while OnAkEventCallback is bound.
+	 *
+	 * @param AkEvent		The event to post
+	 * @param bMarkers		Notify when a marker of the event is reached
+	 * @param bDuration		Notify of the duration of each sound that starts playing
+	 * @param bMusicSync	Notify of the music beats, bars, entry and exit cues, grid and user cues
+	 * @return				Handle that can be used to stop or query this instance of the event
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkComponent")
+	FAkPlayingHandle PostAkEventWithCallbacks( class UAkAudioEvent * AkEvent, bool bMarkers, bool bDuration, bool bMusicSync );
+
+	/** Called on the game thread for the notifications of the events posted on this component */
+	UPROPERTY(BlueprintAssignable, Category="Audiokinetic|AkComponent")
+	FOnAkEventCallback OnAkEventCallback;
+
+	/**
+	 * Stops a single event instance posted on this component
+	 *
+	 * @param Handle		Handle returned when the event was posted
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkComponent")
+	void StopPlayingHandle( const FAkPlayingHandle& Handle );
+
+	/**
+	 * Whether an event instance posted on this component is still playing
+	 *
+	 * @param Handle		Handle returned when the event was posted
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Audiokinetic|AkComponent")
+	bool IsPlayingHandle( const FAkPlayingHandle& Handle ) const;
+
+	/**
+	 * Returns the number of events currently playing on this component
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Audiokinetic|AkComponent")
+	int32 GetNumPlayingEvents() const;
 	
 	/**
 	 * Sets an RTPC value, using this component as the game object source
@@ -161,6 +309,52 @@ public:
 	virtual void OnUpdateTransform(bool bSkipPhysicsMove, ETeleportType Teleport = ETeleportType::None) override;
 	// End USceneComponent Interface
 
+protected:
+	// Begin UActorComponent Interface
+	virtual void RegisterComponentTickFunctions(bool bRegister) override;
+	// End UActorComponent Interface
+
+	/** Send the position of this component to Wwise, and look up the reverb volumes at it */
+	virtual void UpdateGameObjectPosition();
+
+	/** Whether the component manager may update this component. Components that must run every frame keep their own tick. */
+	virtual bool CanBeManaged() const
+	{
+		return true;
+	}
+
+	/**
+	 * Send positions computed by a subclass, instead of the component's location. A single position is sent
+	 * with SetPosition, through the command queue when it is enabled; several with SetMultiplePositions, right away,
+	 * after the pending commands so that a queued SetPosition cannot override it.
+	 *
+	 * @param in_pPositions		World positions, all oriented like the component
+	 * @param in_iNumPositions	Number of positions, at most 65535
+	 * @param in_eType			How Wwise renders several positions
+	 */
+	void SetGameObjectPositions( const FVector * in_pPositions, int32 in_iNumPositions, AK::SoundEngine::MultiPositionType in_eType );
+
+	/** Look up the reverb volumes at GetReverbVolumeQueryPosition, if this component uses them */
+	void UpdateReverbVolumesAtPosition();
+
+	/** Position at which the reverb volumes of this component are looked up */
+	virtual FVector GetReverbVolumeQueryPosition() const
+	{
+		return GetComponentLocation();
+	}
+
+	/**
+	 * Position from which the occlusion of a listener is traced
+	 *
+	 * @param in_ListenerPosition	Position of the listener
+	 */
+	virtual FVector GetOcclusionSourcePosition( const FVector& in_ListenerPosition ) const
+	{
+		return GetComponentLocation();
+	}
+
+public:
+
 	/** Gets all AkReverbVolumes at the AkComponent's current location, and puts them in a list
 	 *
 	 * @param OutReverbVolumes		Array containing the found AkReverbVolumes
@@ -168,29 +362,226 @@ public:
 	 */
 	void UpdateAkReverbVolumeList(FVector Loc);
 
+	/**
+	 * Compute the occlusion of the listeners right away, with synchronous traces. Pending asynchronous traces are dropped.
+	 *
+	 * @param CalledFromTick	Whether the occlusion fades to the new values. Otherwise, they are set and sent to Wwise at once.
+	 */
 	void CalculateOcclusionValues(bool CalledFromTick);
 
+	/** Start the asynchronous occlusion traces from the source to each listener. Their results are consumed on the next frame. */
+	void StartOcclusionTraces();
+
+	/** Consume the results of the pending occlusion traces, starting the secondary traces of the listeners whose direct path is blocked */
+	void ConsumeOcclusionTraces();
+
+	/**
+	 * Whether the occlusion sent to Wwise is recent enough to post an event without computing it again: it was
+	 * computed for every listener within the refresh interval, or asynchronous traces are on their way.
+	 */
+	bool IsOcclusionUpToDate() const;
+
+	/** Query parameters of the occlusion traces, ignoring the pawn of the first player. Reused across refreshes. */
+	const FCollisionQueryParams& UpdateOcclusionQueryParams();
+
+	/**
+	 * Put this component to sleep if dormancy is enabled and no event is playing on it: it stops
+	 * ticking (or being updated by the component manager) and following its transform.
+	 *
+	 * @return true if the component became dormant
+	 */
+	bool TryEnterDormancy();
+
+	/**
+	 * Wake this component up if it is dormant. Its position, reverb volumes and occlusion are sent
+	 * right away, without fading, so that an event posted next plays with them.
+	 *
+	 * @return true if the component was dormant
+	 */
+	bool WakeFromDormancy();
+
+	/** Whether this component is dormant */
+	bool IsDormant() const { return bDormant; }
+
+	/**
+	 * Register the game object of this component with Wwise if lazy registration left it unregistered,
+	 * and send the active listeners and attenuation scaling factor set on it since. See FAkGameObjectRegistrar.
+	 *
+	 * @return true if the game object was registered by this call
+	 */
+	bool EnsureGameObjectRegistered();
+
+	/**
+	 * Register the game object of this component if needed, and keep it registered until the component
+	 * is destroyed. Used before setting values that Wwise forgets with the game object, such as RTPCs and switches.
+	 */
+	void KeepGameObjectRegistered();
+
+	/** Whether the game object of this component is registered with Wwise */
+	bool IsGameObjectRegistered() const { return bGameObjectRegistered; }
+
+	/**
+	 * Unregister the game object of this component and make it dormant, unless values that Wwise would forget
+	 * were set on it. It is registered again, and wakes up, when it is next used. The events playing on it must
+	 * have been stopped, as Wwise keeps playing them without their game object.
+	 *
+	 * @return true if the game object was unregistered
+	 */
+	bool ReleaseGameObject();
+
+	/**
+	 * Posts an event to Wwise using its ID, using this component as the game object source
+	 *
+	 * @param in_EventID	The Wwise ID of the event to post
+	 * @return				The playing ID assigned by the sound engine, or AK_INVALID_PLAYING_ID
+	 */
+	AkPlayingID PostAkEventByID( AkUniqueID in_EventID );
+
+	/**
+	 * Posts an event to Wwise using its ID, using this component as the game object source.
+	 * Posts from other threads are made by the game thread on its next update, through FAkAudioDevice::PostEventFromWorkerThread, and return an invalid handle.
+	 *
+	 * @param in_EventID			The Wwise ID of the event to post
+	 * @param in_uCallbackFlags		Notifications to broadcast through OnAkEventCallback. See \ref AkCallbackType
+	 * @return						Handle that can be used to stop or query this instance of the event
+	 */
+	FAkPlayingHandle PostAkEventByIDWithHandle( AkUniqueID in_EventID, AkUInt32 in_uCallbackFlags = 0 );
+
+	/**
+	 * Gets the playing IDs of the events currently playing on this component
+	 *
+	 * @param out_PlayingIDs	Filled with the playing IDs
+	 */
+	void GetPlayingIDs( TArray<AkPlayingID>& out_PlayingIDs ) const;
+
+	/**
+	 * Whether an event posted on this component would be out of range of every listener. See FAkAudioDevice::IsOutOfAudibleRange.
+	 *
+	 * @param in_pEvent		Event about to be posted
+	 */
+	virtual bool IsOutOfAudibleRange( const class UAkAudioEvent * in_pEvent ) const;
+
+	/**
+	 * Apply the concurrency rules of an event about to be posted on this component. See FAkAudioDevice::ApplyConcurrencyRules.
+	 *
+	 * @param in_pEvent		Event about to be posted
+	 * @return false if the post must be skipped
+	 */
+	bool PassesConcurrencyRules( const class UAkAudioEvent * in_pEvent );
+
+	/**
+	 * Sets an RTPC value on this game object using the RTPC ID
+	 *
+	 * @param in_RtpcID				The Wwise ID of the RTPC
+	 * @param Value					Value to set
+	 * @param InterpolationTimeMs	Duration during which the RTPC is interpolated towards Value (in ms)
+	 */
+	void SetRTPCValueByID( AkRtpcID in_RtpcID, float Value, int32 InterpolationTimeMs );
+
+	/**
+	 * Posts a trigger on this game object using the trigger ID
+	 *
+	 * @param in_TriggerID			The Wwise ID of the trigger
+	 */
+	void PostTriggerByID( AkTriggerID in_TriggerID );
+
+	/**
+	 * Sets a switch group on this game object using IDs
+	 *
+	 * @param in_SwitchGroupID		The Wwise ID of the switch group
+	 * @param in_SwitchStateID		The Wwise ID of the switch
+	 */
+	void SetSwitchByID( AkSwitchGroupID in_SwitchGroupID, AkSwitchStateID in_SwitchStateID );
+
 	void SetAutoDestroy(bool in_AutoDestroy) { bAutoDestroy = in_AutoDestroy; }
 
-	/** Thread safe counter for number of active events */
-	FThreadSafeCounter NumActiveEvents;
+	/** Number of events posted with an end of event notification that did not end yet. Only used from the game thread. */
+	int32 NumActiveEvents;
 
 	/** Flag indicating we will soon destroy this AkComponent */
 	bool bFlaggedForDestroy;
 
 private:
+	friend class FAkPositionBatcher;
+	friend class FAkComponentManager;
+	friend class FAkComponentPool;
+	friend class FAkGameObjectRegistrar;
+	friend class FAkAmbientVirtualizer;
+	friend class FAkCrowdAggregator;
+	friend class FAkAudioDevice;
+
+	/** World and slot of this component in the component manager, or INDEX_NONE when it ticks by itself */
+	UWorld * ManagerWorld;
+	int32 ManagerSlot;
+
+	/** Hand the per-frame update of this component to the component manager, if it is enabled */
+	void AddToComponentManager();
+
+	/** Whether this component stopped updating until the next event or trigger posted on it */
+	bool bDormant;
+
+	/** Posts made on this component from other threads that the game thread did not make yet. They count as playing events. */
+	FThreadSafeCounter NumDeferredPosts;
+
+	/** Whether this component was created by the component pool, and can be returned to it */
+	bool bPooled;
+
+	/** Whether the game object is registered with Wwise. Only false with lazy registration, in which case the component is dormant. */
+	bool bGameObjectRegistered;
+
+	/** Whether the game object must not be unregistered when idle, as values were set on it that Wwise would forget */
+	bool bKeepGameObjectRegistered;
+
+	/** Time of its world at which the game object is unregistered if it stays idle, as queued in the game object registrar */
+	double IdleExpiryTime;
+
+	/**
+	 * Unregister the game object of this component, and make it dormant, if nothing is playing on it.
+	 * It is registered again when it is next used.
+	 *
+	 * @return true if the game object was unregistered
+	 */
+	bool TryUnregisterIdleGameObject();
+
+	/** Active listeners last set with SetActiveListeners, sent again when the game object is registered */
+	int32 ActiveListenerMask;
+	bool bHasActiveListenerMask;
+
+	/** Send ActiveListenerMask to Wwise */
+	void SendActiveListeners();
+
+	/** Deactivate and detach this component, and give it a fresh game object, before it goes back to the pool */
+	void ResetForPool();
+
+	/** Called once the events of an auto destroyed component have ended */
+	void DestroyOrReturnToPool();
+
+	/** Whether this component is waiting in the position batcher */
+	bool bPositionDirty;
+
+	/** Last transform sent by the position batcher, used to skip small moves */
+	bool bHasSubmittedPosition;
+	FVector SubmittedPosition;
+	FVector SubmittedFront;
+
 	/**
 	 * Register the component with Wwise
 	 */
 	void RegisterGameObject();
 
+	/** Cookie of this component's handler in the callback dispatcher, registered on first use */
+	void * GetCallbackCookie();
+
+	/** Called on the game thread for the notifications of the events posted on this component */
+	void HandleAkCallback( const struct FAkCallbackPayload& in_Payload );
+
+	void * CallbackCookie;
+
 	/**
 	 * Unregister the component from Wwise
 	 */
 	void UnregisterGameObject();
 
-	void UpdateGameObjectPosition();
-
 	// Reverb Volume features ---------------------------------------------------------------------
 
 	/** Computes the increment to apply to a fading AkReverbVolume for a given time increment.
@@ -213,8 +604,19 @@ private:
 	/** Apply the current list of AkReverbVolumes 
 	 *
 	 * @param DeltaTime		The given time increment since last fade computation
+	 * @return				true while an AkReverbVolume is still fading
 	 */
-	void ApplyAkReverbVolumeList(float DeltaTime);
+	bool ApplyAkReverbVolumeList(float DeltaTime);
+
+	/** Advance the fades of the AkReverbVolumes and sort them by priority. Touches nothing but this component, so that the component manager can run it on worker threads.
+	 *
+	 * @param DeltaTime		The given time increment since last fade computation
+	 * @return				true while an AkReverbVolume is still fading
+	 */
+	bool AdvanceAkReverbVolumeFades(float DeltaTime);
+
+	/** Fill the aux send values of the highest priority AkReverbVolumes, as sent by ApplyAkReverbVolumeList */
+	void GetAuxSendValues( TArray<AkAuxSendValue>& out_AuxSends, int32 in_iMaxAuxBus ) const;
 
 	struct AkReverbVolumeFadeControl
 	{
@@ -253,21 +655,73 @@ private:
 	 */
 	void SetOcclusion(const float DeltaTime);
 
+	/**
+	 * Advance the occlusion fades of the listeners. Touches nothing but this component, so that the component manager can run it on worker threads.
+	 *
+	 * @param DeltaTime		Time elasped since last function call.
+	 * @return				Mask of the listeners whose occlusion changed
+	 */
+	uint32 AdvanceOcclusionFades(const float DeltaTime);
+
+	/** Send the occlusion of the listeners in a mask to Wwise */
+	void SendOcclusionValues(uint32 in_uListenerMask);
+
+	/**
+	 * Consume the occlusion traces started on the previous frame, or start new ones if the refresh interval elapsed
+	 * since the occlusion was last computed. The new target values are reached through the occlusion fades.
+	 */
+	void RefreshOcclusionIfDue();
+
 	/** Last time occlusion was refreshed */
 	float LastOcclusionRefresh;
 
+	/** Number of points around an obstacle through which the secondary occlusion paths go */
+	static const int32 NUM_OCCLUSION_POINTS = 12;
+
+	/** Stage of the asynchronous occlusion traces of a listener */
+	enum EOcclusionTraceStage
+	{
+		OTS_Idle,
+		/** Waiting for the trace from the source to the listener */
+		OTS_Direct,
+		/** Waiting for the traces from the listener and the source to the points around the obstacle */
+		OTS_Secondary,
+	};
+
 	struct FAkListenerOcclusion
 	{
 		float CurrentValue;
 		float TargetValue;
 
+		EOcclusionTraceStage TraceStage;
+		/** Positions the pending traces were started from */
+		FVector ListenerPosition;
+		FVector SourcePosition;
+		FTraceHandle DirectTrace;
+		/** Listener to point, then source to point, for each point around the obstacle */
+		FTraceHandle SecondaryTraces[2 * NUM_OCCLUSION_POINTS];
+
 		FAkListenerOcclusion( float in_TargetValue = 0.0f, float in_CurrentValue = 0.0f) :
 			CurrentValue(in_CurrentValue),
-			TargetValue(in_TargetValue){};
+			TargetValue(in_TargetValue),
+			TraceStage(OTS_Idle){};
 	};
 
 	TArray< FAkListenerOcclusion > ListenerOcclusionInfo;
 
+	/** Scratch result of the occlusion trace queries, kept between refreshes to avoid reallocating its hits */
+	FTraceDatum OcclusionTraceDatum;
+
+	/** Scratch query parameters and points around the obstacle of the occlusion traces */
+	FCollisionQueryParams OcclusionQueryParams;
+	FVector OcclusionPoints[NUM_OCCLUSION_POINTS];
+
+	/** Whether the occlusion of a listener has not reached its target value yet */
+	bool IsOcclusionFading() const;
+
+	/** Whether occlusion traces started on a previous frame still have to be consumed */
+	bool IsOcclusionTracePending() const;
+
 	static const float OCCLUSION_FADE_RATE;
 
 #endif
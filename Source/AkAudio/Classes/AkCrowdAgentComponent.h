@@ -0,0 +1,86 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkCrowdAgentComponent.h:
+=============================================================================*/
+
+#pragma once
+
+#include "Components/SceneComponent.h"
+#include "AkCrowdAgentComponent.generated.h"
+
+/*------------------------------------------------------------------------------------
+	UAkCrowdAgentComponent
+------------------------------------------------------------------------------------*/
+/**
+ * Lightweight contribution of an agent to the sound of a crowd. It has no game object of its
+ * own: the agents playing the same crowd event are aggregated per cell of a grid, each cell
+ * playing the event once from the centroid of its agents. See FAkCrowdAggregator and the
+ * Crowd Aggregation settings.
+ *
+ * Only the agents nearest to a listener get an AkComponent, on which the events posted with
+ * PostAgentEvent play. The events posted on the other agents are dropped.
+ */
+UCLASS(ClassGroup=Audiokinetic, BlueprintType, hidecategories=(Rendering,Mobility,LOD,Component,Activation), meta=(BlueprintSpawnableComponent))
+class AKAUDIO_API UAkCrowdAgentComponent: public USceneComponent
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+
+	/** Looping event played by the cells for the agents sharing it. Agents without one only play their own events. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AkCrowdAgent")
+	class UAkAudioEvent * CrowdEvent;
+
+	/** Contribution of this agent to the intensity RTPC of its cell, and weight of its location in the centroid of the cell */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AkCrowdAgent", meta=(ClampMin=0.0))
+	float Intensity;
+
+	/**
+	 * Post an event for this agent only, such as a footstep or a line of chatter. It plays if the agent is among the
+	 * nearest to a listener, and is dropped otherwise since the cell of the agent stands for it.
+	 *
+	 * @param AkEvent		Event to post
+	 * @return true if the event was posted
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkCrowdAgent")
+	bool PostAgentEvent( class UAkAudioEvent * AkEvent );
+
+	/** Whether this agent is among the nearest to a listener, and has an individual emitter */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Audiokinetic|AkCrowdAgent")
+	bool IsIndividual() const
+	{
+		return bIndividual;
+	}
+
+#if CPP
+
+	/** Emitter of the events posted on this agent, or NULL if none was needed since it last became individual */
+	UAkComponent * GetIndividualEmitter() const
+	{
+		return IndividualEmitter;
+	}
+
+	// Begin UActorComponent interface.
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
+	// End UActorComponent interface.
+
+private:
+	friend class FAkCrowdAggregator;
+
+	/** Destroy the individual emitter once the events playing on it have ended. Returns true if it was destroyed. */
+	bool ReleaseIndividualEmitterIfIdle();
+
+	/** Whether this agent was among the nearest to a listener on the last update of the crowd aggregator */
+	bool bIndividual;
+
+	/** Slot of this agent in the crowd aggregator, or INDEX_NONE */
+	int32 AggregatorSlot;
+
+#endif
+
+	/** Created on the first event posted while individual. Kept referenced for the garbage collector. */
+	UPROPERTY(Transient)
+	UAkComponent * IndividualEmitter;
+};
@@ -68,6 +68,15 @@ class AKAUDIO_API UAkGameplayStatics : public UBlueprintFunctionLibrary
 	UFUNCTION(BlueprintCallable, Category="Audiokinetic", meta=(WorldContext="WorldContextObject", DeprecatedFunction, DeprecationMessage = "Please use the \"Event Name\" field of PostEventAtLocation"))
 	static void PostEventAtLocationByName(const FString& EventName, FVector Location, FRotator Orientation, UObject* WorldContextObject );
 
+	/** Reports a physics impact that should make a sound. Impacts are merged per frame: only the strongest ones in each area are posted,
+	 * at their location, as fire and forget sounds. See the Impact Aggregation settings.
+	 * @param AkEvent - Wwise Event to post for the impact.
+	 * @param Location - Location of the impact.
+	 * @param Intensity - Strength of the impact, set on the impact intensity RTPC. Stronger impacts are kept first.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic", meta=(WorldContext="WorldContextObject"))
+	static void PostImpactAtLocation(class UAkAudioEvent* AkEvent, FVector Location, float Intensity, UObject* WorldContextObject );
+
 	/** Spawn an AkComponent at a location. Allows, for example, to set a switch on a fire and forget sound.
 	 * @param AkEvent - Wwise Event to post.
 	 * @param Location - Location from which to post the Wwise Event.
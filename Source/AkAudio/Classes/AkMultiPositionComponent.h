@@ -0,0 +1,111 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkMultiPositionComponent.h:
+=============================================================================*/
+
+#pragma once
+
+#include "AkComponent.h"
+#include "AkMultiPositionComponent.generated.h"
+
+/*------------------------------------------------------------------------------------
+	EAkMultiPositionType
+------------------------------------------------------------------------------------*/
+/** How Wwise renders the positions of a multi-position emitter. See AK::SoundEngine::MultiPositionType. */
+UENUM(BlueprintType)
+namespace EAkMultiPositionType
+{
+	enum Type
+	{
+		/** Every position is a separate source: the volumes add up, as with one emitter per position */
+		MultiSources,
+		/** The positions are directions of a single source: the loudest position sets the volume */
+		MultiDirections,
+	};
+}
+
+/*------------------------------------------------------------------------------------
+	UAkMultiPositionComponent
+------------------------------------------------------------------------------------*/
+/**
+ * AkComponent that plays its events from several world positions at once, with a single game
+ * object. Use it for sources spread over an area, such as rivers, rows of torches or crowds,
+ * instead of one AkComponent per point.
+ *
+ * Reverb volumes and occlusion are computed once for the whole component: the reverb volumes
+ * at the position closest to a listener, looked up again as the listeners move, and the occlusion
+ * of each listener from the position closest to it.
+ */
+UCLASS(ClassGroup=Audiokinetic, BlueprintType, hidecategories=(Transform,Rendering,Mobility,LOD,Component,Activation), AutoExpandCategories=AkComponent, meta=(BlueprintSpawnableComponent))
+class AKAUDIO_API UAkMultiPositionComponent: public UAkComponent
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+
+	/** World positions of the emitter. When empty, the component's own location is used. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AkComponent")
+	TArray<FVector> Positions;
+
+	/** Whether the positions are separate sources, or directions of a single source */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AkComponent")
+	TEnumAsByte<EAkMultiPositionType::Type> MultiPositionType;
+
+	/**
+	 * Replace the positions of this emitter and send them to Wwise
+	 *
+	 * @param in_Positions		World positions of the emitter. At most 65535 are used.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkComponent")
+	void SetPositions( const TArray<FVector>& in_Positions );
+
+	/**
+	 * Change how Wwise renders the positions of this emitter
+	 *
+	 * @param in_eType			Whether the positions are separate sources, or directions of a single source
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkComponent")
+	void SetMultiPositionType( EAkMultiPositionType::Type in_eType );
+
+	/**
+	 * Get the position of this emitter closest to a point
+	 *
+	 * @param in_Point			Point to measure the distances from
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Audiokinetic|AkComponent")
+	FVector GetClosestPosition( const FVector& in_Point ) const;
+
+#if CPP
+
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+	virtual bool IsOutOfAudibleRange( const class UAkAudioEvent * in_pEvent ) const override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty( FPropertyChangedEvent& PropertyChangedEvent ) override;
+#endif
+
+protected:
+	// Begin UAkComponent Interface
+	virtual bool CanBeManaged() const override
+	{
+		return false;
+	}
+	virtual void UpdateGameObjectPosition() override;
+	virtual FVector GetReverbVolumeQueryPosition() const override;
+	virtual FVector GetOcclusionSourcePosition( const FVector& in_ListenerPosition ) const override;
+	// End UAkComponent Interface
+
+private:
+	/** Position closest to any listener, or the component's location if there is no listener */
+	FVector GetClosestPositionToListeners() const;
+
+	/** Look up the reverb volumes again if the position closest to the listeners changed since they were */
+	void UpdateReverbVolumesIfClosestChanged();
+
+	/** Position at which the reverb volumes were last looked up */
+	FVector ReverbQueryPoint;
+	bool bHasReverbQueryPoint;
+
+#endif
+};
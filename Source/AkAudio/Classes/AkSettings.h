@@ -2,6 +2,36 @@
 
 #include "AkSettings.generated.h"
 
+/** Update rates of the AkComponents within a distance of their closest listener */
+USTRUCT()
+struct FAkDistanceLODTier
+{
+	GENERATED_USTRUCT_BODY()
+
+	// AkComponents up to this distance from their closest listener use this tier, unless a closer tier applies, in game units.
+	UPROPERTY(Config, EditAnywhere, Category="Distance LOD", meta=(ClampMin=0))
+	float MaxDistance;
+
+	// Minimum time between two position updates, in seconds. 0 sends every move.
+	UPROPERTY(Config, EditAnywhere, Category="Distance LOD", meta=(ClampMin=0))
+	float PositionUpdateInterval;
+
+	// Minimum time between two reverb volume send updates while they fade, in seconds. 0 updates them every frame.
+	UPROPERTY(Config, EditAnywhere, Category="Distance LOD", meta=(ClampMin=0))
+	float ReverbUpdateInterval;
+
+	// Minimum time between two occlusion refreshes, in seconds. The AkComponent's own interval applies if it is longer.
+	UPROPERTY(Config, EditAnywhere, Category="Distance LOD", meta=(ClampMin=0))
+	float OcclusionRefreshInterval;
+
+	FAkDistanceLODTier()
+		: MaxDistance(0.0f)
+		, PositionUpdateInterval(0.0f)
+		, ReverbUpdateInterval(0.0f)
+		, OcclusionRefreshInterval(0.0f)
+	{}
+};
+
 UCLASS(config = Game, defaultconfig)
 class AKAUDIO_API UAkSettings : public UObject
 {
@@ -11,6 +41,126 @@ class AKAUDIO_API UAkSettings : public UObject
 	UPROPERTY(Config, EditAnywhere, Category="Ak Reverb Volume")
 	uint8 MaxSimultaneousReverbVolumes;
 
+	// Defer the sound engine calls made by the integration to a lock-free queue that is submitted once per frame, right before audio is rendered. Allows game objects to be driven from worker threads.
+	UPROPERTY(Config, EditAnywhere, Category="Sound Engine Commands")
+	bool bUseCommandQueue;
+
+	// The number of sound engine calls that can be queued between two frames. Calls beyond this are kept in a slower overflow list.
+	UPROPERTY(Config, EditAnywhere, Category="Sound Engine Commands", meta=(ClampMin=64, EditCondition="bUseCommandQueue"))
+	int32 CommandQueueSize;
+
+	// The number of sound engine notifications (end of event, markers, music sync...) that can wait for the game thread between two frames. Notifications beyond this are kept in a slower overflow list.
+	UPROPERTY(Config, EditAnywhere, Category="Sound Engine Commands", meta=(ClampMin=2, ClampMax=65536))
+	int32 CallbackQueueSize;
+
+	// The number of game objects kept registered for events posted at a location. They are recycled when their event ends; events posted while all of them are busy get a temporary game object.
+	UPROPERTY(Config, EditAnywhere, Category="Sound Engine Commands", meta=(ClampMin=0, ClampMax=16384))
+	int32 OneShotEmitterPoolSize;
+
+	// Combine the RTPC, switch and state writes made during a frame: only the last value per game object is sent. RTPC values are also dropped when they repeat the last value sent, unless an event was posted on the game object since.
+	UPROPERTY(Config, EditAnywhere, Category="Sound Engine Commands")
+	bool bCoalesceParameterWrites;
+
+	// RTPC changes smaller than or equal to this value are not sent to the sound engine. 0 only drops exact repeats.
+	UPROPERTY(Config, EditAnywhere, Category="Sound Engine Commands", meta=(ClampMin=0, EditCondition="bCoalesceParameterWrites"))
+	float RTPCCoalesceEpsilon;
+
+	// Submit the positions of the AkComponents that moved once per frame, instead of on every transform change. Moves smaller than the epsilons below are not submitted.
+	UPROPERTY(Config, EditAnywhere, Category="Sound Engine Commands")
+	bool bBatchPositionUpdates;
+
+	// AkComponents that moved by this distance or less since their position was last submitted are not submitted again, in game units.
+	UPROPERTY(Config, EditAnywhere, Category="Sound Engine Commands", meta=(ClampMin=0, EditCondition="bBatchPositionUpdates"))
+	float PositionUpdateEpsilon;
+
+	// AkComponents that turned by this angle or less since their orientation was last submitted are not submitted again, in degrees.
+	UPROPERTY(Config, EditAnywhere, Category="Sound Engine Commands", meta=(ClampMin=0, ClampMax=180, EditCondition="bBatchPositionUpdates"))
+	float OrientationUpdateEpsilon;
+
+	// Update all AkComponents from the audio device once per frame, one loop per world, instead of each component ticking. Components without pending reverb volume fades or occlusion work are skipped at the cost of a flag test.
+	UPROPERTY(Config, EditAnywhere, Category="Component Update")
+	bool bCentralizedComponentUpdate;
+
+	// Distance LOD tiers of the AkComponents updated centrally. Components farther than every tier use the farthest one. Leave empty to update every component at full rate.
+	UPROPERTY(Config, EditAnywhere, Category="Component Update", meta=(EditCondition="bCentralizedComponentUpdate"))
+	TArray<FAkDistanceLODTier> DistanceLODTiers;
+
+	// Compute the reverb volume and occlusion fades of the centrally updated AkComponents in batches on the task graph. The sound engine calls and occlusion traces stay on the game thread.
+	UPROPERTY(Config, EditAnywhere, Category="Component Update", meta=(EditCondition="bCentralizedComponentUpdate"))
+	bool bParallelComponentUpdate;
+
+	// AkComponents on which no event is playing stop updating their position, reverb volumes and occlusion, until an event or a trigger is posted on them.
+	UPROPERTY(Config, EditAnywhere, Category="Component Update")
+	bool bEnableComponentDormancy;
+
+	// The number of AkComponents kept per game world for SpawnAkComponentAtLocation. They are created when the world is initialized, and auto destroyed components go back to the pool instead of being destroyed. 0 disables pooling.
+	UPROPERTY(Config, EditAnywhere, Category="Component Update", meta=(ClampMin=0, ClampMax=4096))
+	int32 ComponentPoolSize;
+
+	// AkComponents are registered with the sound engine when an event, trigger, RTPC or switch is first used on them, instead of when their level loads. They are unregistered again once no event has played on them for GameObjectIdleTimeout.
+	UPROPERTY(Config, EditAnywhere, Category="Component Update")
+	bool bLazyGameObjectRegistration;
+
+	// Time after the end of its last event before the game object of an AkComponent is unregistered, in seconds.
+	UPROPERTY(Config, EditAnywhere, Category="Component Update", meta=(EditCondition="bLazyGameObjectRegistration", ClampMin=0.0))
+	float GameObjectIdleTimeout;
+
+	// Do not post events that no listener can hear: the emitter is farther than the event's maximum attenuation radius (scaled by the emitter's attenuation scaling factor) from every listener. Only events whose Playback Type is One Shot are culled; posts that request callbacks are never culled.
+	UPROPERTY(Config, EditAnywhere, Category="Audibility Culling")
+	bool bEnableAudibilityCulling;
+
+	// Distance added to the attenuation radius before culling an event, in game units.
+	UPROPERTY(Config, EditAnywhere, Category="Audibility Culling", meta=(ClampMin=0, EditCondition="bEnableAudibilityCulling"))
+	float AudibilityCullingMargin;
+
+	// Events of Playback Type Looping started by AkAmbientSounds are stopped, and their game object unregistered, while every listener is farther than the event's maximum attenuation radius (scaled by the emitter's attenuation scaling factor) plus the hysteresis. They are posted again once a listener comes within the radius.
+	UPROPERTY(Config, EditAnywhere, Category="Ambient Virtualization")
+	bool bVirtualizeAmbientSounds;
+
+	// Distance beyond the attenuation radius at which an ambient sound is stopped, in game units. Keeps ambient sounds at the edge of their radius from stopping and restarting.
+	UPROPERTY(Config, EditAnywhere, Category="Ambient Virtualization", meta=(ClampMin=0, EditCondition="bVirtualizeAmbientSounds"))
+	float AmbientVirtualizationHysteresis;
+
+	// Time in which every ambient sound is checked once, in seconds. The checks are spread over the frames.
+	UPROPERTY(Config, EditAnywhere, Category="Ambient Virtualization", meta=(ClampMin=0, EditCondition="bVirtualizeAmbientSounds"))
+	float AmbientVirtualizationInterval;
+
+	// Restarted loops seek to where they would be had they kept playing, instead of starting over. Requires the events to be seekable.
+	UPROPERTY(Config, EditAnywhere, Category="Ambient Virtualization", meta=(EditCondition="bVirtualizeAmbientSounds"))
+	bool bSeekRestartedAmbientSounds;
+
+	// Impacts reported through PostImpactAtLocation are grouped per event in cubic cells of this size, in game units. Only the strongest impacts of each cell are posted every frame.
+	UPROPERTY(Config, EditAnywhere, Category="Impact Aggregation", meta=(ClampMin=0))
+	float ImpactBucketSize;
+
+	// The number of impacts posted per cell and per frame. The others are merged into them.
+	UPROPERTY(Config, EditAnywhere, Category="Impact Aggregation", meta=(ClampMin=1, ClampMax=64))
+	int32 MaxImpactsPerBucket;
+
+	// Name of the RTPC set to the intensity of each impact before it is posted. Leave empty to not set any.
+	UPROPERTY(Config, EditAnywhere, Category="Impact Aggregation")
+	FString ImpactIntensityRTPC;
+
+	// AkCrowdAgentComponents playing the same crowd event are grouped in cubic cells of this size, in game units. Each cell plays the event once, from the centroid of its agents.
+	UPROPERTY(Config, EditAnywhere, Category="Crowd Aggregation", meta=(ClampMin=0))
+	float CrowdCellSize;
+
+	// The number of crowd agents nearest to a listener that play their own events on an individual AkComponent. The events posted on the other agents are dropped.
+	UPROPERTY(Config, EditAnywhere, Category="Crowd Aggregation", meta=(ClampMin=0, ClampMax=256))
+	int32 MaxIndividualCrowdAgents;
+
+	// Name of the RTPC set to the number of agents of each cell. Leave empty to not set any.
+	UPROPERTY(Config, EditAnywhere, Category="Crowd Aggregation")
+	FString CrowdDensityRTPC;
+
+	// Name of the RTPC set to the sum of the intensities of the agents of each cell. Leave empty to not set any.
+	UPROPERTY(Config, EditAnywhere, Category="Crowd Aggregation")
+	FString CrowdIntensityRTPC;
+
+	// Time a cell left without agents keeps playing, with a density of 0, before its event is stopped, in seconds. Keeps agents crossing cell boundaries from restarting the crowd event.
+	UPROPERTY(Config, EditAnywhere, Category="Crowd Aggregation", meta=(ClampMin=0))
+	float CrowdCellReleaseDelay;
+
 	// Wwise Project Path
 	UPROPERTY(Config, EditAnywhere, Category="Installation", meta=(FilePathFilter="wproj", AbsolutePath))
 	FFilePath WwiseProjectPath;
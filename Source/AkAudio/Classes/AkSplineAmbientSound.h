@@ -0,0 +1,26 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkSplineAmbientSound.h:
+=============================================================================*/
+#pragma once
+
+#include "AkAmbientSound.h"
+#include "AkSplineAmbientSound.generated.h"
+
+/*------------------------------------------------------------------------------------
+	AAkSplineAmbientSound
+------------------------------------------------------------------------------------*/
+/**
+ * Ambient sound emitted along a spline, from the point closest to the listener. Replaces the
+ * ambient sounds placed one after the other along roads, rivers and coastlines.
+ */
+UCLASS(config=Engine, hidecategories=Audio, AutoExpandCategories=AkAmbientSound, BlueprintType)
+class AKAUDIO_API AAkSplineAmbientSound : public AAkAmbientSound
+{
+	GENERATED_UCLASS_BODY()
+
+	/** Spline along which the sound is emitted */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category=AkAmbientSound)
+	class USplineComponent * Spline;
+};
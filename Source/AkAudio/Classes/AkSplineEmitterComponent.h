@@ -0,0 +1,134 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkSplineEmitterComponent.h:
+=============================================================================*/
+
+#pragma once
+
+#include "AkComponent.h"
+#include "AkSplineEmitterComponent.generated.h"
+
+/*------------------------------------------------------------------------------------
+	UAkSplineEmitterComponent
+------------------------------------------------------------------------------------*/
+/**
+ * AkComponent that plays its events from the point of a spline closest to the listener, for
+ * sources laid along a path such as roads, rivers and coastlines.
+ *
+ * The spline is sampled into a polyline once, and again only when it moves. Every frame, the
+ * closest point to each listener is searched from the segment found on the previous frame,
+ * walking to the neighbouring segments while they get closer, so the cost does not depend on
+ * the length of the spline unless the listener jumps. The whole polyline is searched again
+ * every FullSearchInterval, in case the walk stopped on a segment that is only locally closest.
+ *
+ * With one listener, its closest point is sent with SetPosition. With several, the closest
+ * point of each listener is sent with SetMultiplePositions, as directions of a single source.
+ *
+ * The component keeps its own tick, as the position follows the listeners, and is not updated
+ * by the component manager.
+ */
+UCLASS(ClassGroup=Audiokinetic, BlueprintType, hidecategories=(Transform,Rendering,Mobility,LOD,Component,Activation), AutoExpandCategories=AkComponent, meta=(BlueprintSpawnableComponent))
+class AKAUDIO_API UAkSplineEmitterComponent: public UAkComponent
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+
+	/** Spline along which the sound is emitted. Without one, this component behaves like an AkComponent. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AkComponent")
+	class USplineComponent * Spline;
+
+	/** Distance between the points at which the spline is sampled, in world units */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="AkComponent", meta=(ClampMin=1.0))
+	float SampleSpacing;
+
+	/** Time between searches of the whole spline, in seconds. Set to 0 to search it every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category="AkComponent", meta=(ClampMin=0.0))
+	float FullSearchInterval;
+
+	/**
+	 * Use another spline, and sample it again
+	 *
+	 * @param in_pSpline		Spline along which the sound is emitted
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkComponent")
+	void SetSpline( class USplineComponent * in_pSpline );
+
+	/**
+	 * Sample the spline again. Call after changing its points.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkComponent")
+	void RefreshSpline();
+
+	/**
+	 * Get the point of the spline closest to a listener, as of the last update
+	 *
+	 * @param in_iListenerIndex		Index of the listener
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Audiokinetic|AkComponent")
+	FVector GetClosestPointToListener( int32 in_iListenerIndex ) const;
+
+#if CPP
+
+	virtual void OnRegister() override;
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+	virtual bool IsOutOfAudibleRange( const class UAkAudioEvent * in_pEvent ) const override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty( FPropertyChangedEvent& PropertyChangedEvent ) override;
+#endif
+
+protected:
+	// Begin UAkComponent Interface
+	virtual bool CanBeManaged() const override
+	{
+		return false;
+	}
+	virtual void UpdateGameObjectPosition() override;
+	virtual FVector GetReverbVolumeQueryPosition() const override;
+	virtual FVector GetOcclusionSourcePosition( const FVector& in_ListenerPosition ) const override;
+	// End UAkComponent Interface
+
+private:
+	/** Sample the spline into SamplePoints, in world space */
+	void SampleSpline();
+
+	/**
+	 * Find the closest point of the polyline to each listener, and send them if they moved
+	 *
+	 * @param in_bFullSearch	Search the whole polyline instead of walking from the previous segments
+	 */
+	void UpdateClosestPoints( bool in_bFullSearch );
+
+	/** Closest point to a position on a segment of the polyline */
+	FVector GetClosestPointOnSegment( int32 in_iSegment, const FVector& in_Position ) const;
+
+	/** Segment closest to a position, searched over the whole polyline */
+	int32 FindClosestSegment( const FVector& in_Position ) const;
+
+	/** Segment closest to a position, walking from a segment to its neighbours while they get closer */
+	int32 WalkToClosestSegment( int32 in_iStartSegment, const FVector& in_Position ) const;
+
+	/** Closest point of any listener, or the component's location if there is no spline or no listener */
+	FVector GetClosestPointToListeners() const;
+
+	/** The spline sampled every SampleSpacing, in world space. Segment i goes from point i to point i + 1. */
+	TArray<FVector> SamplePoints;
+
+	/** Transform of the spline when it was sampled */
+	FTransform SampledSplineTransform;
+
+	/** Segment, and point on it, closest to each listener */
+	TArray<int32> ListenerSegments;
+	TArray<FVector> ClosestPoints;
+
+	/** Point at which the reverb volumes were last looked up */
+	FVector ReverbQueryPoint;
+	bool bHasReverbQueryPoint;
+
+	/** Time until the next search of the whole polyline */
+	float TimeToFullSearch;
+
+#endif
+};
@@ -0,0 +1,116 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkVolumeEmitterComponent.h:
+=============================================================================*/
+
+#pragma once
+
+#include "AkComponent.h"
+#include "AkVolumeEmitterComponent.generated.h"
+
+/*------------------------------------------------------------------------------------
+	UAkVolumeEmitterComponent
+------------------------------------------------------------------------------------*/
+/**
+ * AkComponent that plays its events from the point of a brush closest to the listener, for
+ * ambiences that fill an area such as forests or machine rooms. A listener inside the brush
+ * hears the sound from its own position.
+ *
+ * The convex hulls of the brush collision are turned into planes once, and again only when
+ * the brush moves. Every frame, the closest point to each listener is found from these planes
+ * alone, without physics queries: a listener inside every plane of a hull is inside it, and
+ * otherwise it is projected on the hull by alternating projections on the planes.
+ *
+ * With one listener, its closest point is sent with SetPosition. With several, the closest
+ * point of each listener is sent with SetMultiplePositions, as directions of a single source.
+ *
+ * The component keeps its own tick, as the position follows the listeners, and is not updated
+ * by the component manager.
+ */
+UCLASS(ClassGroup=Audiokinetic, BlueprintType, hidecategories=(Transform,Rendering,Mobility,LOD,Component,Activation), AutoExpandCategories=AkComponent, meta=(BlueprintSpawnableComponent))
+class AKAUDIO_API UAkVolumeEmitterComponent: public UAkComponent
+{
+	GENERATED_UCLASS_BODY()
+
+public:
+
+	/** Brush filled by the sound. Without one, this component behaves like an AkComponent. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="AkComponent")
+	class UBrushComponent * Brush;
+
+	/**
+	 * Use another brush, and compute its planes again
+	 *
+	 * @param in_pBrush		Brush filled by the sound
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkComponent")
+	void SetBrush( class UBrushComponent * in_pBrush );
+
+	/**
+	 * Compute the planes of the brush again. Call after changing its shape.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Audiokinetic|AkComponent")
+	void RefreshBrush();
+
+	/**
+	 * Get the point of the brush closest to a listener, as of the last update
+	 *
+	 * @param in_iListenerIndex		Index of the listener
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, Category="Audiokinetic|AkComponent")
+	FVector GetClosestPointToListener( int32 in_iListenerIndex ) const;
+
+#if CPP
+
+	virtual void OnRegister() override;
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+	virtual bool IsOutOfAudibleRange( const class UAkAudioEvent * in_pEvent ) const override;
+
+protected:
+	// Begin UAkComponent Interface
+	virtual bool CanBeManaged() const override
+	{
+		return false;
+	}
+	virtual void UpdateGameObjectPosition() override;
+	virtual FVector GetReverbVolumeQueryPosition() const override;
+	virtual FVector GetOcclusionSourcePosition( const FVector& in_ListenerPosition ) const override;
+	// End UAkComponent Interface
+
+private:
+	/** Compute the planes of the convex hulls of the brush collision, in world space */
+	void BuildHullPlanes();
+
+	/** Compute the planes again if the brush moved since they were computed */
+	void RefreshHullPlanesIfMoved();
+
+	/** Find the closest point of the brush to each listener, and send them if they moved */
+	void UpdateClosestPoints();
+
+	/** Closest point of the brush to a position: the position itself if it is inside */
+	FVector GetClosestPointInBrush( const FVector& in_Position ) const;
+
+	/** Closest point of a convex hull to a position outside of it */
+	FVector GetClosestPointInHull( int32 in_iHull, const FVector& in_Position ) const;
+
+	/** Closest point of any listener, or the component's location if there is no brush or no listener */
+	FVector GetClosestPointToListeners() const;
+
+	/** Outward planes of every hull. The planes of hull i are HullPlanes[HullPlaneStarts[i]] to HullPlanes[HullPlaneStarts[i + 1] - 1]. */
+	TArray<FPlane> HullPlanes;
+	TArray<int32> HullPlaneStarts;
+
+	/** Transform of the brush when its planes were computed */
+	FTransform HulledBrushTransform;
+	bool bHasHullPlanes;
+
+	/** Point closest to each listener */
+	TArray<FVector> ClosestPoints;
+
+	/** Point at which the reverb volumes were last looked up */
+	FVector ReverbQueryPoint;
+	bool bHasReverbQueryPoint;
+
+#endif
+};
@@ -12,24 +12,18 @@
 	AAkAmbientSound
 ------------------------------------------------------------------------------------*/
 
-/**
- * Static callback for ambient sounds
- */
-static void AkAmbientSoundCallback( AkCallbackType in_eType, AkCallbackInfo* in_pCallbackInfo )
-{
-	AAkAmbientSound * pObj = ( (AAkAmbientSound *) in_pCallbackInfo->pCookie );
-	if( pObj && pObj->IsValidLowLevelFast(false) )
-	{
-		pObj->Playing( false );
-	}
-}
-
 AAkAmbientSound::AAkAmbientSound(const class FObjectInitializer& ObjectInitializer) :
 Super(ObjectInitializer)
 {
 	// Property initialization
 	StopWhenOwnerIsDestroyed = true;
 	CurrentlyPlaying = false;
+	CallbackCookie = NULL;
+	PlayingID = AK_INVALID_PLAYING_ID;
+	bVirtual = false;
+	LoopDuration = 0.0f;
+	PlayStartTime = 0.0f;
+	VirtualizerSlot = INDEX_NONE;
 	
 	AkComponent = ObjectInitializer.CreateDefaultSubobject<UAkComponent>(this, TEXT("AkAudioComponent0"));
 	
@@ -64,9 +58,16 @@ void AAkAmbientSound::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
 	if( AkAudioDevice )
+	{
+		AkAudioDevice->GetAmbientVirtualizer().Remove( this );
+	}
+
+	if( AkAudioDevice && CallbackCookie )
 	{
 		// We're about to get destroyed, cancel our callbacks...
-		AkAudioDevice->CancelEventCallbackCookie(this);
+		AkAudioDevice->CancelEventCallbackCookie( CallbackCookie );
+		AkAudioDevice->GetCallbackDispatcher().UnregisterHandler( CallbackCookie );
+		CallbackCookie = NULL;
 	}
 
 	Super::EndPlay(EndPlayReason);
@@ -107,15 +108,14 @@ void AAkAmbientSound::StartPlaying()
 {
 	if( !IsCurrentlyPlaying() && AkComponent->AkAudioEvent )
 	{
-		FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
-		if( AkAudioDevice )
+		UWorld * World = GetWorld();
+		PlayStartTime = World ? World->GetTimeSeconds() : 0.0f;
+		LoopDuration = 0.0f;
+
+		Playing( true );
+		if( !PostAmbientEvent() )
 		{
-			Playing( true );
-			AkAudioDevice->SetAttenuationScalingFactor(this, AkComponent->AttenuationScalingFactor);
-			if (AkAudioDevice->PostEvent( AkComponent->AkAudioEvent, this, AK_EndOfEvent, &AkAmbientSoundCallback, this, StopWhenOwnerIsDestroyed ) == AK_INVALID_PLAYING_ID)
-			{
-				Playing( false );
-			}
+			Playing( false );
 		}
 	}
 }
@@ -124,19 +124,161 @@ void AAkAmbientSound::StopPlaying()
 {
 	if( IsCurrentlyPlaying() )
 	{
+		if( bVirtual )
+		{
+			// Nothing is playing on the sound engine side.
+			bVirtual = false;
+			Playing( false );
+
+			FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+			if( AkAudioDevice )
+			{
+				AkAudioDevice->GetAmbientVirtualizer().Remove( this );
+			}
+			return;
+		}
+
 		// State of CurrentlyPlaying gets updated in UAkComponent::Stop() through the EndOfEvent callback.
 		AkComponent->Stop();
 	}
 }
 
+bool AAkAmbientSound::PostAmbientEvent()
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !AkAudioDevice )
+	{
+		return false;
+	}
+
+	if( CallbackCookie == NULL )
+	{
+		CallbackCookie = AkAudioDevice->GetCallbackDispatcher().RegisterHandler( FAkGameThreadCallback::CreateUObject( this, &AAkAmbientSound::HandleAkCallback ) );
+	}
+
+	// Loops are virtualized when out of range. Their duration tells where to seek when they restart.
+	FAkAmbientVirtualizer& AmbientVirtualizer = AkAudioDevice->GetAmbientVirtualizer();
+	const bool bVirtualizable = AmbientVirtualizer.IsEnabled() && AkComponent->AkAudioEvent->IsLooping();
+	AkUInt32 CallbackFlags = AK_EndOfEvent;
+	if( bVirtualizable && AmbientVirtualizer.ShouldSeekOnRestart() && LoopDuration <= 0.0f )
+	{
+		CallbackFlags |= AK_Duration;
+	}
+
+	AkAudioDevice->SetAttenuationScalingFactor(this, AkComponent->AttenuationScalingFactor);
+	PlayingID = AkAudioDevice->PostEvent( AkComponent->AkAudioEvent, this, CallbackFlags, &FAkCallbackDispatcher::AudioThreadCallback, CallbackCookie, StopWhenOwnerIsDestroyed );
+	if( PlayingID == AK_INVALID_PLAYING_ID )
+	{
+		return false;
+	}
+
+	if( bVirtualizable )
+	{
+		AmbientVirtualizer.Add( this );
+	}
+	return true;
+}
+
+void AAkAmbientSound::Virtualize()
+{
+	if( bVirtual || !IsCurrentlyPlaying() )
+	{
+		return;
+	}
+
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !AkAudioDevice )
+	{
+		return;
+	}
+
+	// The end of the stopped instance is ignored, so the ambient sound stays playing. The other events posted on
+	// the component are left alone.
+	const AkPlayingID StoppedID = PlayingID;
+	bVirtual = true;
+	PlayingID = AK_INVALID_PLAYING_ID;
+	AkAudioDevice->StopPlayingID( StoppedID );
+
+	// Unregistering the game object would stop the other events: it is only released when the ambience was all that played on it.
+	if( AkComponent->NumActiveEvents > 0 )
+	{
+		return;
+	}
+
+	TArray<AkPlayingID> PlayingIDs;
+	AkAudioDevice->GetPlayingIDRegistry().GetPlayingIDs( (AkGameObjectID)AkComponent, PlayingIDs );
+	for( int32 Idx = 0; Idx < PlayingIDs.Num(); Idx++ )
+	{
+		if( PlayingIDs[Idx] != StoppedID )
+		{
+			return;
+		}
+	}
+
+	// Queued stops are sent before the game object goes away.
+	AkComponent->ReleaseGameObject();
+}
+
+void AAkAmbientSound::RestartFromVirtual()
+{
+	if( !bVirtual )
+	{
+		return;
+	}
+
+	bVirtual = false;
+	if( !AkComponent->AkAudioEvent || !PostAmbientEvent() )
+	{
+		Playing( false );
+
+		FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+		if( AkAudioDevice )
+		{
+			AkAudioDevice->GetAmbientVirtualizer().Remove( this );
+		}
+		return;
+	}
+
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	UWorld * World = GetWorld();
+	if( AkAudioDevice && AkAudioDevice->GetAmbientVirtualizer().ShouldSeekOnRestart() && LoopDuration > 0.0f && World )
+	{
+		// Posted right away from the game thread, so the event can be seeked now.
+		const float LoopPosition = FMath::Fmod( World->GetTimeSeconds() - PlayStartTime, LoopDuration );
+		AK::SoundEngine::SeekOnEvent( AkComponent->AkAudioEvent->GetEventId(), (AkGameObjectID)AkComponent, (AkTimeMs)( LoopPosition * 1000.0f ) );
+	}
+}
+
+void AAkAmbientSound::HandleAkCallback( const FAkCallbackPayload& in_Payload )
+{
+	if( in_Payload.PlayingID != PlayingID )
+	{
+		return;
+	}
+
+	if( in_Payload.Type == AK_EndOfEvent )
+	{
+		PlayingID = AK_INVALID_PLAYING_ID;
+		Playing( false );
+
+		FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+		if( AkAudioDevice )
+		{
+			AkAudioDevice->GetAmbientVirtualizer().Remove( this );
+		}
+	}
+	else if( in_Payload.Type == AK_Duration && LoopDuration <= 0.0f && in_Payload.Duration.Duration > 0.0f )
+	{
+		LoopDuration = in_Payload.Duration.Duration / 1000.0f;
+	}
+}
+
 void AAkAmbientSound::Playing( bool in_IsPlaying )
 {
-	FScopeLock Lock(&PlayingCriticalSection);
 	CurrentlyPlaying = in_IsPlaying;
 }
 
 bool AAkAmbientSound::IsCurrentlyPlaying()
 {
-	FScopeLock Lock(&PlayingCriticalSection);
 	return CurrentlyPlaying;
 }
@@ -0,0 +1,157 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkAmbientVirtualizer.cpp: Game-side virtualization of looping ambient sounds.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "AkAmbientVirtualizer.h"
+
+/*------------------------------------------------------------------------------------
+	FAkAmbientVirtualizer
+------------------------------------------------------------------------------------*/
+
+FAkAmbientVirtualizer::FAkAmbientVirtualizer()
+	: NextCheck(0)
+	, CheckBudget(0.0f)
+	, Hysteresis(0.0f)
+	, CheckInterval(0.0f)
+	, bSeekOnRestart(false)
+	, bEnabled(false)
+{
+	FMemory::Memzero( Stats );
+}
+
+void FAkAmbientVirtualizer::Init( float in_fHysteresis, float in_fCheckInterval, bool in_bSeekOnRestart )
+{
+	Hysteresis = FMath::Max( in_fHysteresis, 0.0f );
+	CheckInterval = FMath::Max( in_fCheckInterval, 0.0f );
+	bSeekOnRestart = in_bSeekOnRestart;
+	bEnabled = true;
+}
+
+void FAkAmbientVirtualizer::Term()
+{
+	for( int32 Idx = 0; Idx < AmbientSounds.Num(); Idx++ )
+	{
+		AAkAmbientSound * AmbientSound = AmbientSounds[Idx].Get();
+		if( AmbientSound )
+		{
+			AmbientSound->VirtualizerSlot = INDEX_NONE;
+		}
+	}
+	AmbientSounds.Empty();
+	NextCheck = 0;
+	CheckBudget = 0.0f;
+	bEnabled = false;
+}
+
+void FAkAmbientVirtualizer::Add( AAkAmbientSound * in_pAmbientSound )
+{
+	if( bEnabled && in_pAmbientSound->VirtualizerSlot == INDEX_NONE )
+	{
+		in_pAmbientSound->VirtualizerSlot = AmbientSounds.Add( in_pAmbientSound );
+	}
+}
+
+void FAkAmbientVirtualizer::Remove( AAkAmbientSound * in_pAmbientSound )
+{
+	const int32 Slot = in_pAmbientSound->VirtualizerSlot;
+	if( AmbientSounds.IsValidIndex( Slot ) && AmbientSounds[Slot].Get() == in_pAmbientSound )
+	{
+		RemoveAt( Slot );
+	}
+	in_pAmbientSound->VirtualizerSlot = INDEX_NONE;
+}
+
+void FAkAmbientVirtualizer::RemoveAt( int32 in_Index )
+{
+	AmbientSounds.RemoveAtSwap( in_Index, 1, false );
+	if( in_Index < AmbientSounds.Num() )
+	{
+		AAkAmbientSound * MovedAmbientSound = AmbientSounds[in_Index].Get();
+		if( MovedAmbientSound )
+		{
+			MovedAmbientSound->VirtualizerSlot = in_Index;
+		}
+	}
+}
+
+uint32 FAkAmbientVirtualizer::Update( float in_fDeltaTime, const TArray<FVector>& in_Listeners )
+{
+	if( !bEnabled || AmbientSounds.Num() == 0 || in_Listeners.Num() == 0 )
+	{
+		return 0;
+	}
+
+	// Spread the checks so that every ambient sound is checked once per interval.
+	const float NumAmbientSounds = (float)AmbientSounds.Num();
+	CheckBudget += CheckInterval > 0.0f ? NumAmbientSounds * in_fDeltaTime / CheckInterval : NumAmbientSounds;
+	CheckBudget = FMath::Min( CheckBudget, NumAmbientSounds );
+	int32 NumToCheck = FMath::FloorToInt( CheckBudget );
+	CheckBudget -= NumToCheck;
+
+	uint32 NumChanged = 0;
+	while( NumToCheck-- > 0 && AmbientSounds.Num() > 0 )
+	{
+		if( NextCheck >= AmbientSounds.Num() )
+		{
+			NextCheck = 0;
+		}
+
+		AAkAmbientSound * AmbientSound = AmbientSounds[NextCheck].Get();
+		if( AmbientSound == NULL )
+		{
+			// The last entry moves here, and is checked next.
+			RemoveAt( NextCheck );
+			continue;
+		}
+
+		NextCheck++;
+		if( CheckAmbientSound( AmbientSound, in_Listeners ) )
+		{
+			NumChanged++;
+		}
+	}
+
+	return NumChanged;
+}
+
+bool FAkAmbientVirtualizer::CheckAmbientSound( AAkAmbientSound * in_pAmbientSound, const TArray<FVector>& in_Listeners )
+{
+	UAkComponent * Component = in_pAmbientSound->AkComponent;
+	const UAkAudioEvent * Event = Component ? Component->AkAudioEvent : NULL;
+	if( Event == NULL || Event->MaxAttenuationRadius <= 0.0f )
+	{
+		return false;
+	}
+
+	Stats.NumChecked++;
+
+	float MinDistanceSquared = MAX_FLT;
+	for( int32 ListenerIdx = 0; ListenerIdx < in_Listeners.Num(); ListenerIdx++ )
+	{
+		const FVector& ListenerPosition = in_Listeners[ListenerIdx];
+		MinDistanceSquared = FMath::Min( MinDistanceSquared, FVector::DistSquared( Component->GetOcclusionSourcePosition( ListenerPosition ), ListenerPosition ) );
+	}
+
+	const float AudibleRadius = Event->MaxAttenuationRadius * Component->AttenuationScalingFactor;
+	if( in_pAmbientSound->bVirtual )
+	{
+		if( MinDistanceSquared <= FMath::Square( AudibleRadius ) )
+		{
+			Stats.NumRestarted++;
+			in_pAmbientSound->RestartFromVirtual();
+			return true;
+		}
+	}
+	else if( MinDistanceSquared > FMath::Square( AudibleRadius + Hysteresis ) )
+	{
+		Stats.NumVirtualized++;
+		in_pAmbientSound->Virtualize();
+		return true;
+	}
+
+	return false;
+}
@@ -0,0 +1,53 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkAmbientVolume.cpp:
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "Components/BrushComponent.h"
+
+/*------------------------------------------------------------------------------------
+	AAkAmbientVolume
+------------------------------------------------------------------------------------*/
+
+AAkAmbientVolume::AAkAmbientVolume(const class FObjectInitializer& ObjectInitializer) :
+	Super(ObjectInitializer)
+{
+	// Property initialization
+	static FName CollisionProfileName(TEXT("OverlapAll"));
+	BrushComponent->SetCollisionProfileName(CollisionProfileName);
+
+	bColored = true;
+	BrushColor = FColor(255, 160, 0, 255);
+
+	bAutoPlay = true;
+
+	AkComponent = ObjectInitializer.CreateDefaultSubobject<UAkVolumeEmitterComponent>(this, TEXT("AkAudioComponent0"));
+	AkComponent->AttachParent = BrushComponent;
+	AkComponent->Brush = BrushComponent;
+}
+
+void AAkAmbientVolume::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if( bAutoPlay )
+	{
+		StartAmbientSound();
+	}
+}
+
+void AAkAmbientVolume::StartAmbientSound()
+{
+	if( AkComponent->GetNumPlayingEvents() == 0 )
+	{
+		AkComponent->PostAssociatedAkEvent();
+	}
+}
+
+void AAkAmbientVolume::StopAmbientSound()
+{
+	AkComponent->Stop();
+}
@@ -0,0 +1,340 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkAudioCommandQueue.cpp: Deferred submission of sound engine commands.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioCommandQueue.h"
+
+/*------------------------------------------------------------------------------------
+	FAkAudioCommand
+------------------------------------------------------------------------------------*/
+
+void FAkAudioCommand::Execute() const
+{
+	switch( Type )
+	{
+	case PostEvent:
+		AK::SoundEngine::PostEvent( Event.EventID, GameObjID, Event.Flags, Event.Callback, Event.Cookie );
+		break;
+
+	case PostTrigger:
+		AK::SoundEngine::PostTrigger( Group.GroupID, GameObjID );
+		break;
+
+	case SetRTPCValue:
+		AK::SoundEngine::SetRTPCValue( Rtpc.RtpcID, Rtpc.Value, GameObjID, Rtpc.InterpolationTimeMs );
+		break;
+
+	case SetSwitch:
+		AK::SoundEngine::SetSwitch( Group.GroupID, Group.ValueID, GameObjID );
+		break;
+
+	case SetState:
+		AK::SoundEngine::SetState( Group.GroupID, Group.ValueID );
+		break;
+
+	case SetPosition:
+		AK::SoundEngine::SetPosition( GameObjID, Position );
+		break;
+
+	case SetAuxSends:
+		AK::SoundEngine::SetGameObjectAuxSendValues( GameObjID, const_cast<AkAuxSendValue*>(AuxSends.Values), AuxSends.NumValues );
+		break;
+
+	case SetObstructionOcclusion:
+		AK::SoundEngine::SetObjectObstructionAndOcclusion( GameObjID, ObstructionOcclusion.ListenerIndex, ObstructionOcclusion.Obstruction, ObstructionOcclusion.Occlusion );
+		break;
+
+	case SetAttenuationScalingFactor:
+		AK::SoundEngine::SetAttenuationScalingFactor( GameObjID, ScalingFactor );
+		break;
+
+	case SetActiveListeners:
+		AK::SoundEngine::SetActiveListeners( GameObjID, ListenerMask );
+		break;
+
+	case StopAll:
+		AK::SoundEngine::StopAll( GameObjID );
+		break;
+
+	case StopPlayingID:
+		AK::SoundEngine::StopPlayingID( PlayingID );
+		break;
+	}
+}
+
+/*------------------------------------------------------------------------------------
+	FAkAudioCommandQueue
+------------------------------------------------------------------------------------*/
+
+FAkAudioCommandQueue::FAkAudioCommandQueue()
+	: Slots(nullptr)
+	, Mask(0)
+	, EnqueuePos(0)
+	, DequeuePos(0)
+{
+}
+
+FAkAudioCommandQueue::~FAkAudioCommandQueue()
+{
+	delete[] Slots;
+	Slots = nullptr;
+}
+
+void FAkAudioCommandQueue::Init( uint32 in_uCapacity )
+{
+	check( Slots == nullptr );
+
+	const uint32 Capacity = FMath::RoundUpToPowerOfTwo( FMath::Max<uint32>( in_uCapacity, 2 ) );
+	Slots = new FSlot[Capacity];
+	Mask = Capacity - 1;
+	for( uint32 Idx = 0; Idx < Capacity; Idx++ )
+	{
+		Slots[Idx].Sequence = (int32)Idx;
+	}
+
+	EnqueuePos = 0;
+	DequeuePos = 0;
+	NumOverflows.Reset();
+	NumPendingOverflows.Reset();
+}
+
+void FAkAudioCommandQueue::Term()
+{
+	if( Slots )
+	{
+		Flush();
+		delete[] Slots;
+		Slots = nullptr;
+	}
+
+	FScopeLock Lock( &OverflowCriticalSection );
+	OverflowCommands.Empty();
+	NumPendingOverflows.Reset();
+}
+
+uint32 FAkAudioCommandQueue::Flush()
+{
+	uint32 NumExecuted = 0;
+	FAkAudioCommand Command;
+	while( Dequeue(Command) )
+	{
+		Command.Execute();
+		NumExecuted++;
+	}
+
+	// The commands that overflowed were written after the ones in the ring buffer. A slot that is still
+	// being written keeps them for the next flush.
+	if( NumPendingOverflows.GetValue() > 0 && DequeuePos == EnqueuePos )
+	{
+		TArray<FAkAudioCommand> Commands;
+		{
+			FScopeLock Lock( &OverflowCriticalSection );
+			Exchange( Commands, OverflowCommands );
+			NumPendingOverflows.Reset();
+		}
+
+		for( int32 Idx = 0; Idx < Commands.Num(); Idx++ )
+		{
+			Commands[Idx].Execute();
+		}
+		NumExecuted += Commands.Num();
+	}
+	return NumExecuted;
+}
+
+void FAkAudioCommandQueue::Enqueue( const FAkAudioCommand& in_Command )
+{
+	// Once a command overflowed, the following ones join it until the next flush, so that they stay in order.
+	if( NumPendingOverflows.GetValue() == 0 && TryEnqueue( in_Command ) )
+	{
+		return;
+	}
+
+	// Nothing waits for the game thread to make room: it may be waiting on this thread.
+	FScopeLock Lock( &OverflowCriticalSection );
+	OverflowCommands.Add( in_Command );
+	NumPendingOverflows.Increment();
+	NumOverflows.Increment();
+}
+
+bool FAkAudioCommandQueue::TryEnqueue( const FAkAudioCommand& in_Command )
+{
+	int32 Pos = EnqueuePos;
+	FSlot* Slot = nullptr;
+	for(;;)
+	{
+		Slot = &Slots[(uint32)Pos & Mask];
+		const int32 Sequence = Slot->Sequence;
+		FPlatformMisc::MemoryBarrier();
+
+		const int32 Diff = (int32)((uint32)Sequence - (uint32)Pos);
+		if( Diff == 0 )
+		{
+			// The slot is free: try to claim it.
+			if( FPlatformAtomics::InterlockedCompareExchange( &EnqueuePos, (int32)((uint32)Pos + 1), Pos ) == Pos )
+			{
+				break;
+			}
+		}
+		else if( Diff < 0 )
+		{
+			// Full.
+			return false;
+		}
+
+		Pos = EnqueuePos;
+	}
+
+	Slot->Command = in_Command;
+	FPlatformMisc::MemoryBarrier();
+	Slot->Sequence = (int32)((uint32)Pos + 1);
+	return true;
+}
+
+bool FAkAudioCommandQueue::Dequeue( FAkAudioCommand& out_Command )
+{
+	if( !Slots )
+	{
+		return false;
+	}
+
+	FSlot& Slot = Slots[(uint32)DequeuePos & Mask];
+	const int32 Sequence = Slot.Sequence;
+	FPlatformMisc::MemoryBarrier();
+
+	if( (int32)((uint32)Sequence - ((uint32)DequeuePos + 1)) < 0 )
+	{
+		// Empty, or the producer that claimed this slot has not finished writing it yet.
+		return false;
+	}
+
+	out_Command = Slot.Command;
+	FPlatformMisc::MemoryBarrier();
+	Slot.Sequence = (int32)((uint32)DequeuePos + Mask + 1);
+	DequeuePos++;
+	return true;
+}
+
+void FAkAudioCommandQueue::EnqueuePostEvent( AkUniqueID in_EventID, AkGameObjectID in_GameObjID, AkUInt32 in_uFlags, AkCallbackFunc in_pfnCallback, void * in_pCookie )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::PostEvent;
+	Command.GameObjID = in_GameObjID;
+	Command.Event.EventID = in_EventID;
+	Command.Event.Flags = in_uFlags;
+	Command.Event.Callback = in_pfnCallback;
+	Command.Event.Cookie = in_pCookie;
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueuePostTrigger( AkTriggerID in_TriggerID, AkGameObjectID in_GameObjID )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::PostTrigger;
+	Command.GameObjID = in_GameObjID;
+	Command.Group.GroupID = in_TriggerID;
+	Command.Group.ValueID = AK_INVALID_UNIQUE_ID;
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueueSetRTPCValue( AkRtpcID in_RtpcID, AkRtpcValue in_Value, AkGameObjectID in_GameObjID, AkTimeMs in_InterpolationTimeMs )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::SetRTPCValue;
+	Command.GameObjID = in_GameObjID;
+	Command.Rtpc.RtpcID = in_RtpcID;
+	Command.Rtpc.Value = in_Value;
+	Command.Rtpc.InterpolationTimeMs = in_InterpolationTimeMs;
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueueSetSwitch( AkSwitchGroupID in_SwitchGroupID, AkSwitchStateID in_SwitchStateID, AkGameObjectID in_GameObjID )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::SetSwitch;
+	Command.GameObjID = in_GameObjID;
+	Command.Group.GroupID = in_SwitchGroupID;
+	Command.Group.ValueID = in_SwitchStateID;
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueueSetState( AkStateGroupID in_StateGroupID, AkStateID in_StateID )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::SetState;
+	Command.GameObjID = AK_INVALID_GAME_OBJECT;
+	Command.Group.GroupID = in_StateGroupID;
+	Command.Group.ValueID = in_StateID;
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueueSetPosition( AkGameObjectID in_GameObjID, const AkSoundPosition& in_Position )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::SetPosition;
+	Command.GameObjID = in_GameObjID;
+	Command.Position = in_Position;
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueueSetAuxSends( AkGameObjectID in_GameObjID, const AkAuxSendValue* in_pAuxSendValues, uint32 in_uNumValues )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::SetAuxSends;
+	Command.GameObjID = in_GameObjID;
+	Command.AuxSends.NumValues = FMath::Min<uint32>( in_uNumValues, AK_MAX_AUX_PER_OBJ );
+	for( uint32 Idx = 0; Idx < Command.AuxSends.NumValues; Idx++ )
+	{
+		Command.AuxSends.Values[Idx] = in_pAuxSendValues[Idx];
+	}
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueueSetObstructionOcclusion( AkGameObjectID in_GameObjID, AkUInt32 in_ListenerIndex, AkReal32 in_Obstruction, AkReal32 in_Occlusion )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::SetObstructionOcclusion;
+	Command.GameObjID = in_GameObjID;
+	Command.ObstructionOcclusion.ListenerIndex = in_ListenerIndex;
+	Command.ObstructionOcclusion.Obstruction = in_Obstruction;
+	Command.ObstructionOcclusion.Occlusion = in_Occlusion;
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueueSetAttenuationScalingFactor( AkGameObjectID in_GameObjID, AkReal32 in_ScalingFactor )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::SetAttenuationScalingFactor;
+	Command.GameObjID = in_GameObjID;
+	Command.ScalingFactor = in_ScalingFactor;
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueueSetActiveListeners( AkGameObjectID in_GameObjID, AkUInt32 in_uListenerMask )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::SetActiveListeners;
+	Command.GameObjID = in_GameObjID;
+	Command.ListenerMask = in_uListenerMask;
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueueStopAll( AkGameObjectID in_GameObjID )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::StopAll;
+	Command.GameObjID = in_GameObjID;
+	Enqueue( Command );
+}
+
+void FAkAudioCommandQueue::EnqueueStopPlayingID( AkPlayingID in_PlayingID )
+{
+	FAkAudioCommand Command;
+	Command.Type = FAkAudioCommand::StopPlayingID;
+	Command.GameObjID = AK_INVALID_GAME_OBJECT;
+	Command.PlayingID = in_PlayingID;
+	Enqueue( Command );
+}
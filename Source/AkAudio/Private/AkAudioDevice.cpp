@@ -43,6 +43,7 @@ DEFINE_LOG_CATEGORY(LogAkAudio);
 #endif
 
 bool FAkAudioDevice::m_bSoundEngineInitialized = false;
+TMap< FAkAudioDevice::FAkComponentLookupKey, TWeakObjectPtr<UAkComponent> > FAkAudioDevice::AkComponentLookupCache;
 
 /*------------------------------------------------------------------------------------
 	Defines
@@ -174,6 +175,8 @@ bool FAkAudioDevice::Init( void )
 
 void FAkAudioDevice::OnLevelRemoved(ULevel* InLevel, UWorld* InWorld)
 {
+	// Drop the lookups of the components that went away with the level.
+	AkComponentLookupCache.Empty();
 	Flush(NULL);
 }
 
@@ -207,6 +210,19 @@ bool FAkAudioDevice::Update( float DeltaTime )
 		}
 		// OCULUS_END
 
+		// Handlers may post events or set parameters: deliver them first so that their calls go out this frame.
+		CallbackDispatcher.Dispatch();
+		// Before the auto destroyed components are checked: a post keeps them alive.
+		PostDeferredEvents();
+		DestroyQueuedComponents();
+		ImpactAggregator.Flush( *this );
+		CrowdAggregator.Update( *this, DeltaTime, m_listenerPositions );
+		ComponentManager.Update( m_listenerPositions );
+		AmbientVirtualizer.Update( DeltaTime, m_listenerPositions );
+		// After everything that moves emitters, so that their positions go out this frame.
+		PositionBatcher.Flush( *this );
+		GameObjectRegistrar.Update();
+		FlushPendingCommands();
 		AK::SoundEngine::RenderAudio();
 		UpdateListeners();
 	}
@@ -214,6 +230,131 @@ bool FAkAudioDevice::Update( float DeltaTime )
 	return true;
 }
 
+/**
+ * Submit the combined parameter writes, then execute the queued sound engine calls.
+ * Must only be called from the game thread.
+ */
+void FAkAudioDevice::FlushPendingCommands()
+{
+	ParameterWriteCombiner.Flush( CommandQueue );
+	CommandQueue.Flush();
+}
+
+void FAkAudioDevice::FlushPendingCommands( AkGameObjectID in_GameObjID )
+{
+	// The writes to the other game objects wait for the end of the frame, where they are combined.
+	ParameterWriteCombiner.FlushGameObject( in_GameObjID, CommandQueue );
+	CommandQueue.Flush();
+}
+
+void FAkAudioDevice::PostEventFromWorkerThread( UAkComponent * in_pComponent, UAkAudioEvent * in_pEvent, AkUniqueID in_EventID, AkUInt32 in_uCallbackFlags )
+{
+	FDeferredPost Post( FDeferredPost::OnComponent, in_pComponent, in_pEvent );
+	Post.EventID = in_EventID;
+	Post.Flags = in_uCallbackFlags;
+	in_pComponent->NumDeferredPosts.Increment();
+	DeferPost( Post );
+}
+
+void FAkAudioDevice::DeferPost( const FDeferredPost& in_Post )
+{
+	FScopeLock Lock( &DeferredPostsLock );
+	DeferredPosts.Add( in_Post );
+}
+
+void FAkAudioDevice::PostDeferredEvents()
+{
+	TArray<FDeferredPost> Posts;
+	{
+		FScopeLock Lock( &DeferredPostsLock );
+		if ( DeferredPosts.Num() == 0 )
+		{
+			return;
+		}
+		Exchange( Posts, DeferredPosts );
+	}
+
+	for ( int32 Idx = 0; Idx < Posts.Num(); Idx++ )
+	{
+		const FDeferredPost& Post = Posts[Idx];
+		UObject * Target = Post.Target.Get();
+		UAkAudioEvent * Event = Post.Event.Get();
+		if ( ( Post.bHasTarget && Target == NULL ) || ( Post.bHasEvent && Event == NULL ) )
+		{
+			// Destroyed in the meantime.
+			continue;
+		}
+
+		switch ( Post.Type )
+		{
+		case FDeferredPost::OnActor:
+			if ( Event )
+			{
+				PostEvent( Event, Cast<AActor>( Target ), Post.Flags, Post.Callback, Post.Cookie, Post.bStopWhenOwnerDestroyed );
+			}
+			else
+			{
+				PostEvent( Post.EventName, Cast<AActor>( Target ), Post.Flags, Post.Callback, Post.Cookie, Post.bStopWhenOwnerDestroyed );
+			}
+			break;
+
+		case FDeferredPost::OnComponent:
+		{
+			// Posts that request callbacks are never culled by audibility, as on the game thread.
+			UAkComponent * Component = CastChecked<UAkComponent>( Target );
+			Component->NumDeferredPosts.Decrement();
+			if ( Event && ( ( Post.Flags == 0 && Component->IsOutOfAudibleRange( Event ) ) || !Component->PassesConcurrencyRules( Event ) ) )
+			{
+				break;
+			}
+			Component->PostAkEventByIDWithHandle( Post.EventID, Post.Flags );
+			break;
+		}
+
+		case FDeferredPost::AtLocation:
+			if ( Event )
+			{
+				PostEventAtLocation( Event, Post.Location, Post.Orientation, Cast<UWorld>( Target ), Post.RtpcID, Post.RtpcValue );
+			}
+			else
+			{
+				PostEventAtLocation( Post.EventName, Post.Location, Post.Orientation, Cast<UWorld>( Target ) );
+			}
+			break;
+		}
+	}
+}
+
+void FAkAudioDevice::QueueAutoDestroy( UAkComponent * in_pComponent )
+{
+	AutoDestroyQueue.Add( in_pComponent );
+}
+
+void FAkAudioDevice::DestroyQueuedComponents()
+{
+	for( int32 Idx = 0; Idx < AutoDestroyQueue.Num(); Idx++ )
+	{
+		UAkComponent * Component = AutoDestroyQueue[Idx].Get();
+		if( Component == NULL || !Component->bAutoDestroy || !Component->bFlaggedForDestroy )
+		{
+			continue;
+		}
+
+		// An event posted since its last one ended keeps the component alive.
+		if( Component->NumActiveEvents == 0 )
+		{
+			Component->DestroyOrReturnToPool();
+		}
+		else
+		{
+			Component->bFlaggedForDestroy = false;
+		}
+	}
+
+	// Keeps the allocation: components are likely to be queued again next frame.
+	AutoDestroyQueue.Reset();
+}
+
 /**
  * Tears down audio device by stopping all sounds, removing all buffers, 
  * destroying all sources, ... Called by both Destroy and ShutdownAfterError
@@ -238,6 +379,25 @@ void FAkAudioDevice::Teardown()
 			delete AkBankManager;
 		}
 
+		ParameterWriteCombiner.Term();
+		CommandQueue.Term();
+		PlayingIDRegistry.Term();
+		CallbackDispatcher.Term();
+		ImpactAggregator.Term();
+		PositionBatcher.Term();
+		ComponentManager.Term();
+		ComponentPool.Term();
+		GameObjectRegistrar.Term();
+		AmbientVirtualizer.Term();
+		CrowdAggregator.Term();
+		OneShotEmitterPool.Term();
+		AutoDestroyQueue.Empty();
+		{
+			FScopeLock Lock( &DeferredPostsLock );
+			DeferredPosts.Empty();
+		}
+		LastPostTimes.Empty();
+
 #ifndef AK_OPTIMIZED
 #if !PLATFORM_LINUX
 		//
@@ -303,8 +463,16 @@ void FAkAudioDevice::Teardown()
  */
 void FAkAudioDevice::StopAllSounds( bool bShouldStopUISounds )
 {
-	AK::SoundEngine::StopAll( DUMMY_GAMEOBJ );
-	AK::SoundEngine::StopAll();
+	if ( CommandQueue.IsEnabled() )
+	{
+		CommandQueue.EnqueueStopAll( DUMMY_GAMEOBJ );
+		CommandQueue.EnqueueStopAll( AK_INVALID_GAME_OBJECT );
+	}
+	else
+	{
+		AK::SoundEngine::StopAll( DUMMY_GAMEOBJ );
+		AK::SoundEngine::StopAll();
+	}
 }
 
 /**
@@ -385,6 +553,112 @@ FVector FAkAudioDevice::GetListenerPosition( int32 ViewportIndex )
 	return m_listenerPositions[ViewportIndex];
 }
 
+/**
+ * Whether an event played at a location would be out of range of every listener
+ *
+ * @param in_pEvent						Event about to be posted
+ * @param in_Location					Location of the emitter
+ * @param in_fAttenuationScalingFactor	Attenuation scaling factor of the emitter
+ * @return true if the post can be skipped
+ */
+bool FAkAudioDevice::IsOutOfAudibleRange( const UAkAudioEvent * in_pEvent, const FVector& in_Location, float in_fAttenuationScalingFactor )
+{
+	if ( !bAudibilityCulling || !in_pEvent || !in_pEvent->IsOneShot() || in_pEvent->MaxAttenuationRadius <= 0.0f || m_listenerPositions.Num() == 0 )
+	{
+		return false;
+	}
+
+	NumAudibilityTestedPosts.Increment();
+
+	const float AudibleRadius = in_pEvent->MaxAttenuationRadius * in_fAttenuationScalingFactor + AudibilityCullingMargin;
+	const float AudibleRadiusSquared = AudibleRadius * AudibleRadius;
+	for ( int32 ListenerIdx = 0; ListenerIdx < m_listenerPositions.Num(); ListenerIdx++ )
+	{
+		if ( FVector::DistSquared( m_listenerPositions[ListenerIdx], in_Location ) <= AudibleRadiusSquared )
+		{
+			return false;
+		}
+	}
+
+	NumAudibilityCulledPosts.Increment();
+	return true;
+}
+
+/**
+ * Apply the concurrency rules of an event about to be posted
+ *
+ * @param in_pEvent		Event about to be posted
+ * @param in_GameObjID	Game object on which it is posted, or AK_INVALID_GAME_OBJECT when it is posted at a location
+ * @param in_pWorld		World the event plays in
+ * @return false if the post must be skipped
+ */
+bool FAkAudioDevice::ApplyConcurrencyRules( const UAkAudioEvent * in_pEvent, AkGameObjectID in_GameObjID, UWorld * in_pWorld )
+{
+	if ( !in_pEvent || !in_pEvent->HasConcurrencyRules() )
+	{
+		return true;
+	}
+
+	const AkUniqueID EventID = in_pEvent->GetEventId();
+
+	// Game time, so that the interval follows pauses and time dilation.
+	const bool bRetriggerInterval = in_pEvent->MinRetriggerInterval > 0.0f && in_pWorld;
+	const double CurrentTime = in_pWorld ? in_pWorld->GetTimeSeconds() : 0.0;
+	if ( bRetriggerInterval )
+	{
+		const TMap<AkUniqueID, double> * EventPostTimes = LastPostTimes.Find( in_GameObjID );
+		const double * LastPostTime = EventPostTimes ? EventPostTimes->Find( EventID ) : NULL;
+
+		// A post time ahead of the current one was made in an earlier world, such as a previous play in editor session.
+		const double Elapsed = LastPostTime ? CurrentTime - *LastPostTime : -1.0;
+		if ( Elapsed >= 0.0 && Elapsed < in_pEvent->MinRetriggerInterval )
+		{
+			NumConcurrencyRejectedPosts.Increment();
+			return false;
+		}
+	}
+
+	FAkPlayingIDRegistry::EStealPolicy StealPolicy = FAkPlayingIDRegistry::StealOldest;
+	switch ( in_pEvent->StealPolicy )
+	{
+	case EAkConcurrencyStealPolicy::Quietest:
+		StealPolicy = FAkPlayingIDRegistry::StealQuietest;
+		break;
+	case EAkConcurrencyStealPolicy::Farthest:
+		StealPolicy = FAkPlayingIDRegistry::StealFarthest;
+		break;
+	default:
+		break;
+	}
+
+	// The per game object limit is checked first, so that the instance stolen for it also makes room globally.
+	const bool bPerGameObjectLimit = in_pEvent->MaxInstancesPerGameObject > 0 && in_GameObjID != AK_INVALID_GAME_OBJECT
+		&& PlayingIDRegistry.GetNumInstances( EventID, in_GameObjID ) >= (uint32)in_pEvent->MaxInstancesPerGameObject;
+	const AkGameObjectID StealScope = bPerGameObjectLimit ? in_GameObjID : AK_INVALID_GAME_OBJECT;
+	if ( bPerGameObjectLimit
+		|| ( in_pEvent->MaxInstances > 0 && PlayingIDRegistry.GetNumInstances( EventID ) >= (uint32)in_pEvent->MaxInstances ) )
+	{
+		const AkPlayingID StolenID = in_pEvent->StealPolicy == EAkConcurrencyStealPolicy::None
+			? AK_INVALID_PLAYING_ID
+			: PlayingIDRegistry.StealInstance( EventID, StealScope, StealPolicy, m_listenerPositions );
+		if ( StolenID == AK_INVALID_PLAYING_ID )
+		{
+			NumConcurrencyRejectedPosts.Increment();
+			return false;
+		}
+
+		// Stopped right away: the new instance is posted after this, and pending commands are flushed before it.
+		StopPlayingID( StolenID );
+		NumConcurrencyStolenInstances.Increment();
+	}
+
+	if ( bRetriggerInterval )
+	{
+		LastPostTimes.FindOrAdd( in_GameObjID ).Add( EventID, CurrentTime );
+	}
+	return true;
+}
+
 /**
  * Stop all audio associated with a scene
  *
@@ -392,8 +666,7 @@ FVector FAkAudioDevice::GetListenerPosition( int32 ViewportIndex )
  */
 void FAkAudioDevice::Flush(UWorld* WorldToFlush)
 {
-	AK::SoundEngine::StopAll( DUMMY_GAMEOBJ );
-	AK::SoundEngine::StopAll();
+	StopAllSounds();
 }
 
 /**
@@ -749,6 +1022,7 @@ void FAkAudioDevice::ReloadAllReferencedBanks()
 	if ( m_bSoundEngineInitialized )
 	{
 		StopAllSounds();
+		FlushPendingCommands();
 		AK::SoundEngine::RenderAudio();
 		FPlatformProcess::Sleep(0.1f);
 		ClearBanks();
@@ -777,7 +1051,43 @@ AkPlayingID FAkAudioDevice::PostEvent(
 	bool in_bStopWhenOwnerDestroyed /*= false*/
     )
 {
-	return PostEvent(in_pEvent->GetName(), in_pActor, in_uFlags, in_pfnCallback, in_pCookie, in_bStopWhenOwnerDestroyed);
+	AkPlayingID playingID = AK_INVALID_PLAYING_ID;
+
+	if ( m_bSoundEngineInitialized && in_pEvent && !IsInGameThread() )
+	{
+		// Finding the component, the audibility and the concurrency rules all use game thread state.
+		FDeferredPost Post( FDeferredPost::OnActor, in_pActor, in_pEvent );
+		Post.Flags = in_uFlags;
+		Post.Callback = in_pfnCallback;
+		Post.Cookie = in_pCookie;
+		Post.bStopWhenOwnerDestroyed = in_bStopWhenOwnerDestroyed;
+		DeferPost( Post );
+		return AK_INVALID_PLAYING_ID;
+	}
+
+	if ( m_bSoundEngineInitialized && in_pEvent )
+	{
+		// PostEvent must be bound to a game object. Passing DUMMY_GAMEOBJ as default game object.
+		AkGameObjectID GameObjID = DUMMY_GAMEOBJ;
+		if( GetGameObjectID( in_pActor, GameObjID, in_bStopWhenOwnerDestroyed ) == AK_Success )
+		{
+			// Posts that expect callbacks are always made, so that their callers get notified.
+			UAkComponent * pComponent = (UAkComponent *)GameObjID;
+			if( in_pfnCallback == NULL && GameObjID != DUMMY_GAMEOBJ
+				&& pComponent->IsOutOfAudibleRange( in_pEvent ) )
+			{
+				return AK_INVALID_PLAYING_ID;
+			}
+
+			if( !ApplyConcurrencyRules( in_pEvent, GameObjID, in_pActor ? in_pActor->GetWorld() : NULL ) )
+			{
+				return AK_INVALID_PLAYING_ID;
+			}
+
+			playingID = PostEventInternal( in_pEvent->GetEventId(), pComponent, in_uFlags, in_pfnCallback, in_pCookie );
+		}
+	}
+	return playingID;
 }
 
 /**
@@ -802,6 +1112,19 @@ AkPlayingID FAkAudioDevice::PostEvent(
 {
 	AkPlayingID playingID = AK_INVALID_PLAYING_ID;
 
+	if ( m_bSoundEngineInitialized && !IsInGameThread() )
+	{
+		// Finding the component uses game thread state.
+		FDeferredPost Post( FDeferredPost::OnActor, in_pActor, NULL );
+		Post.EventName = in_EventName;
+		Post.Flags = in_uFlags;
+		Post.Callback = in_pfnCallback;
+		Post.Cookie = in_pCookie;
+		Post.bStopWhenOwnerDestroyed = in_bStopWhenOwnerDestroyed;
+		DeferPost( Post );
+		return AK_INVALID_PLAYING_ID;
+	}
+
 	if ( m_bSoundEngineInitialized )
 	{
 		// PostEvent must be bound to a game object. Passing DUMMY_GAMEOBJ as default game object.
@@ -994,13 +1317,27 @@ AkPlayingID FAkAudioDevice::PostEventAtLocation(
 	UAkAudioEvent * in_pEvent,
 	FVector in_Location,
 	FVector in_Orientation,
-	UWorld* World )
+	UWorld* World,
+	AkRtpcID in_RtpcID /*= AK_INVALID_RTPC_ID*/,
+	AkRtpcValue in_RtpcValue /*= 0.0f*/ )
 {
 	AkPlayingID playingID = AK_INVALID_PLAYING_ID;
 
-	if ( in_pEvent )
+	if ( m_bSoundEngineInitialized && in_pEvent && !IsInGameThread() )
 	{
-		playingID = PostEventAtLocation(in_pEvent->GetName(), in_Location, in_Orientation, World);
+		// The audibility, the concurrency rules, the emitter pool and the reverb volumes all use game thread state.
+		FDeferredPost Post( FDeferredPost::AtLocation, World, in_pEvent );
+		Post.Location = in_Location;
+		Post.Orientation = in_Orientation;
+		Post.RtpcID = in_RtpcID;
+		Post.RtpcValue = in_RtpcValue;
+		DeferPost( Post );
+		return AK_INVALID_PLAYING_ID;
+	}
+
+	if ( in_pEvent && !IsOutOfAudibleRange( in_pEvent, in_Location, 1.0f ) && ApplyConcurrencyRules( in_pEvent, AK_INVALID_GAME_OBJECT, World ) )
+	{
+		playingID = PostEventAtLocationInternal(in_pEvent->GetEventId(), *in_pEvent->GetName(), in_Location, in_Orientation, World, in_RtpcID, in_RtpcValue);
 	}
 
 	return playingID;
@@ -1018,22 +1355,45 @@ AkPlayingID FAkAudioDevice::PostEventAtLocation(
 	FVector in_Location,
 	FVector in_Orientation,
 	UWorld* World)
+{
+	if ( m_bSoundEngineInitialized && !IsInGameThread() )
+	{
+		// The emitter pool and the reverb volumes use game thread state.
+		FDeferredPost Post( FDeferredPost::AtLocation, World, NULL );
+		Post.EventName = in_EventName;
+		Post.Location = in_Location;
+		Post.Orientation = in_Orientation;
+		DeferPost( Post );
+		return AK_INVALID_PLAYING_ID;
+	}
+
+#ifndef AK_SUPPORT_WCHAR
+	ANSICHAR* szEventName = TCHAR_TO_ANSI(*in_EventName);
+#else
+	const WIDECHAR * szEventName = *in_EventName;
+#endif
+	return PostEventAtLocationInternal(AK::SoundEngine::GetIDFromString(szEventName), *in_EventName, in_Location, in_Orientation, World);
+}
+
+AkPlayingID FAkAudioDevice::PostEventAtLocationInternal(
+	AkUniqueID in_EventID,
+	const TCHAR * in_pszEventName,
+	FVector in_Location,
+	FVector in_Orientation,
+	UWorld* World,
+	AkRtpcID in_RtpcID /*= AK_INVALID_RTPC_ID*/,
+	AkRtpcValue in_RtpcValue /*= 0.0f*/)
 {
 	AkPlayingID playingID = AK_INVALID_PLAYING_ID;
 
 	if ( m_bSoundEngineInitialized )
 	{
-		AkGameObjectID objId = (AkGameObjectID)&in_EventName;
-
-#ifndef AK_OPTIMIZED
-		RegisterGameObj_WithName( objId, *in_EventName );
-#else // AK_OPTIMIZED
-		AK::SoundEngine::RegisterGameObj( objId );
-#endif // AK_OPTIMIZED
+		// The emitter is set up and posted on right away, send what is pending first. Nothing is written to pooled emitters but globally.
+		FlushPendingCommands( AK_INVALID_GAME_OBJECT );
+		ParameterWriteCombiner.ForgetSubmittedRTPCs( AK_INVALID_GAME_OBJECT );
 
 		TArray<AkAuxSendValue> AkReverbVolumes;
 		GetReverbVolumesOnTempEvent(in_Location, AkReverbVolumes, World);
-		SetAuxSends(objId, AkReverbVolumes);
 
 		AkSoundPosition soundpos;
 		FVectorToAKVector( in_Location, soundpos.Position );
@@ -1044,32 +1404,36 @@ AkPlayingID FAkAudioDevice::PostEventAtLocation(
 			UE_LOG(LogAkAudio, Error, TEXT("Orientation Front vector invalid!") );
 		}
 
-		AK::SoundEngine::SetPosition( objId, soundpos );
-
-#ifndef AK_SUPPORT_WCHAR
-		ANSICHAR* szEventName = TCHAR_TO_ANSI(*in_EventName);
-#else
-		const WIDECHAR * szEventName = *in_EventName;
-#endif
-		playingID = AK::SoundEngine::PostEvent( szEventName, objId, 0, NULL, NULL);
-
-		AK::SoundEngine::UnregisterGameObj( objId );
+		playingID = OneShotEmitterPool.PostEvent( PlayingIDRegistry, in_EventID, in_pszEventName, in_Location, soundpos, AkReverbVolumes, in_RtpcID, in_RtpcValue );
 	}
 	return playingID;
 }
 
 UAkComponent* FAkAudioDevice::SpawnAkComponentAtLocation( class UAkAudioEvent* in_pAkEvent, FVector Location, FRotator Orientation, bool AutoPost, const FString& EventName, bool AutoDestroy, UWorld* World )
 {
-	UAkComponent * AkComponent = NewObject<UAkComponent>(World->GetWorldSettings());
+	UAkComponent * AkComponent = NULL;
+	if( ComponentPool.IsEnabled() && World )
+	{
+		// Registered and placed already.
+		AkComponent = ComponentPool.Acquire( World, Location, Orientation );
+	}
+	else
+	{
+		AkComponent = NewObject<UAkComponent>(World->GetWorldSettings());
+		if( AkComponent )
+		{
+			AkComponent->SetWorldLocationAndRotation(Location, Orientation.Quaternion());
+			if(World)
+			{
+				AkComponent->RegisterComponentWithWorld(World);
+			}
+		}
+	}
+
 	if( AkComponent )
 	{
 		AkComponent->AkAudioEvent = in_pAkEvent;
 		AkComponent->EventName = EventName;
-		AkComponent->SetWorldLocationAndRotation(Location, Orientation.Quaternion());
-		if(World)
-		{
-			AkComponent->RegisterComponentWithWorld(World);
-		}
 
 		AkComponent->SetAutoDestroy(AutoDestroy);
 
@@ -1093,17 +1457,41 @@ AKRESULT FAkAudioDevice::PostTrigger(
 	const TCHAR * in_pszTrigger,
 	AActor * in_pActor
 	)
+{
+	return PostTrigger( GetIDFromName(FName(in_pszTrigger)), in_pActor );
+}
+
+/**
+ * Post a trigger to ak soundengine by ID
+ *
+ * @param in_TriggerID		ID of the trigger
+ * @param in_pAkComponent	AkComponent on which to post the trigger
+ * @return Result from ak sound engine
+ */
+AKRESULT FAkAudioDevice::PostTrigger( 
+	AkTriggerID in_TriggerID,
+	AActor * in_pActor
+	)
 {
 	AkGameObjectID GameObjID = AK_INVALID_GAME_OBJECT;
 	AKRESULT eResult = GetGameObjectID( in_pActor, GameObjID );
 	if ( m_bSoundEngineInitialized && eResult == AK_Success)
 	{
-#ifndef AK_SUPPORT_WCHAR
-		ANSICHAR* szTrigger = TCHAR_TO_ANSI(in_pszTrigger);
-#else
-		const WIDECHAR * szTrigger = in_pszTrigger;
-#endif
-		eResult = AK::SoundEngine::PostTrigger( szTrigger, GameObjID );
+		if ( GameObjID != AK_INVALID_GAME_OBJECT )
+		{
+			((UAkComponent*)GameObjID)->WakeFromDormancy();
+		}
+
+		// Triggers are not combined, but must see the switches and states requested before them.
+		ParameterWriteCombiner.FlushGameObject( GameObjID, CommandQueue );
+		if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueuePostTrigger( in_TriggerID, GameObjID );
+		}
+		else
+		{
+			eResult = AK::SoundEngine::PostTrigger( in_TriggerID, GameObjID );
+		}
 	}
 	return eResult;
 } 
@@ -1122,6 +1510,24 @@ AKRESULT FAkAudioDevice::SetRTPCValue(
 	int32 in_interpolationTimeMs = 0,
 	AActor * in_pActor = NULL
 	)
+{
+	return SetRTPCValue( GetIDFromName(FName(in_pszRtpcName)), in_value, in_interpolationTimeMs, in_pActor );
+}
+
+/**
+ * Set a RTPC in ak soundengine by ID
+ *
+ * @param in_RtpcID			ID of the RTPC
+ * @param in_value			Value to set
+ * @param in_pActor			Actor on which to set the RTPC
+ * @return Result from ak sound engine
+ */
+AKRESULT FAkAudioDevice::SetRTPCValue( 
+	AkRtpcID in_RtpcID,
+	AkRtpcValue in_value,
+	int32 in_interpolationTimeMs,
+	AActor * in_pActor
+	)
 {
 	AKRESULT eResult = AK_Success;
 	if ( m_bSoundEngineInitialized )
@@ -1132,14 +1538,25 @@ AKRESULT FAkAudioDevice::SetRTPCValue(
 			eResult = GetGameObjectID( in_pActor, GameObjID );
 			if ( eResult != AK_Success )
 				return eResult;
+
+			if ( GameObjID != AK_INVALID_GAME_OBJECT )
+			{
+				((UAkComponent*)GameObjID)->KeepGameObjectRegistered();
+			}
 		}
 
-#ifndef AK_SUPPORT_WCHAR
-		ANSICHAR* szRtpcName = TCHAR_TO_ANSI(in_pszRtpcName);
-#else
-		const WIDECHAR * szRtpcName = in_pszRtpcName;
-#endif
-		eResult = AK::SoundEngine::SetRTPCValue( szRtpcName, in_value, GameObjID, in_interpolationTimeMs );
+		if ( ParameterWriteCombiner.IsEnabled() )
+		{
+			ParameterWriteCombiner.SetRTPCValue( in_RtpcID, in_value, GameObjID, in_interpolationTimeMs );
+		}
+		else if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetRTPCValue( in_RtpcID, in_value, GameObjID, in_interpolationTimeMs );
+		}
+		else
+		{
+			eResult = AK::SoundEngine::SetRTPCValue( in_RtpcID, in_value, GameObjID, in_interpolationTimeMs );
+		}
 	}
 	return eResult;
 }
@@ -1155,18 +1572,37 @@ AKRESULT FAkAudioDevice::SetState(
 	const TCHAR * in_pszStateGroup,
 	const TCHAR * in_pszState
     )
+{
+	return SetState( GetIDFromName(FName(in_pszStateGroup)), GetIDFromName(FName(in_pszState)) );
+}
+
+/**
+ * Set a state in ak soundengine by ID
+ *
+ * @param in_StateGroupID	ID of the state group
+ * @param in_StateID		ID of the state
+ * @return Result from ak sound engine
+ */
+AKRESULT FAkAudioDevice::SetState( 
+	AkStateGroupID in_StateGroupID,
+	AkStateID in_StateID
+    )
 {
 	AKRESULT eResult = AK_Success;
 	if ( m_bSoundEngineInitialized )
 	{
-#ifndef AK_SUPPORT_WCHAR
-		ANSICHAR* szStateGroup = TCHAR_TO_ANSI(in_pszStateGroup);
-		ANSICHAR* szState = TCHAR_TO_ANSI(in_pszState);
-#else
-		const WIDECHAR * szStateGroup = in_pszStateGroup;
-		const WIDECHAR * szState = in_pszState;
-#endif
-		eResult = AK::SoundEngine::SetState( szStateGroup, szState );
+		if ( ParameterWriteCombiner.IsEnabled() )
+		{
+			ParameterWriteCombiner.SetState( in_StateGroupID, in_StateID );
+		}
+		else if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetState( in_StateGroupID, in_StateID );
+		}
+		else
+		{
+			eResult = AK::SoundEngine::SetState( in_StateGroupID, in_StateID );
+		}
 	}
 	return eResult;
 }
@@ -1184,22 +1620,92 @@ AKRESULT FAkAudioDevice::SetSwitch(
 	const TCHAR * in_pszSwitchState,
 	AActor * in_pActor
 	)
+{
+	return SetSwitch( GetIDFromName(FName(in_pszSwitchGroup)), GetIDFromName(FName(in_pszSwitchState)), in_pActor );
+}
+
+/**
+ * Set a switch in ak soundengine by ID
+ *
+ * @param in_SwitchGroupID	ID of the switch group
+ * @param in_SwitchStateID	ID of the switch
+ * @param in_pComponent		AkComponent on which to set the switch
+ * @return Result from ak sound engine
+ */
+AKRESULT FAkAudioDevice::SetSwitch( 
+	AkSwitchGroupID in_SwitchGroupID,
+	AkSwitchStateID in_SwitchStateID,
+	AActor * in_pActor
+	)
 {
 	AkGameObjectID GameObjID = DUMMY_GAMEOBJ;
 	// Switches must be bound to a game object. passing DUMMY_GAMEOBJ as default game object.
 	AKRESULT eResult = GetGameObjectID( in_pActor, GameObjID );
 	if ( m_bSoundEngineInitialized && eResult == AK_Success)
 	{
+		if ( GameObjID != DUMMY_GAMEOBJ )
+		{
+			((UAkComponent*)GameObjID)->KeepGameObjectRegistered();
+		}
+
+		if ( ParameterWriteCombiner.IsEnabled() )
+		{
+			ParameterWriteCombiner.SetSwitch( in_SwitchGroupID, in_SwitchStateID, GameObjID );
+		}
+		else if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetSwitch( in_SwitchGroupID, in_SwitchStateID, GameObjID );
+		}
+		else
+		{
+			eResult = AK::SoundEngine::SetSwitch( in_SwitchGroupID, in_SwitchStateID, GameObjID );
+		}
+	}
+	return eResult;
+}
+
+/**
+ * Get the Wwise ID of a name. IDs are interned in a process-wide table the first time a name is
+ * seen, so that subsequent lookups neither convert nor hash the string.
+ *
+ * @param in_Name			Name of the Wwise object
+ * @return The Wwise ID of the object
+ */
+AkUInt32 FAkAudioDevice::GetIDFromName( FName in_Name )
+{
+	static FCriticalSection NameIDCacheCriticalSection;
+	static TMap<FName, AkUInt32> NameIDCache;
+
+	{
+		FScopeLock Lock(&NameIDCacheCriticalSection);
+		const AkUInt32* CachedID = NameIDCache.Find(in_Name);
+		if ( CachedID )
+		{
+			return *CachedID;
+		}
+	}
+
+	AkUInt32 NewID = GetIDFromString( *in_Name.ToString() );
+
+	FScopeLock Lock(&NameIDCacheCriticalSection);
+	NameIDCache.Add(in_Name, NewID);
+	return NewID;
+}
+
+/**
+ * Get the Wwise ID of a string, by hashing it the same way the sound engine does.
+ *
+ * @param in_pszString		Name of the Wwise object
+ * @return The Wwise ID of the object
+ */
+AkUInt32 FAkAudioDevice::GetIDFromString( const TCHAR * in_pszString )
+{
 #ifndef AK_SUPPORT_WCHAR
-		ANSICHAR* szSwitchGroup = TCHAR_TO_ANSI(in_pszSwitchGroup);
-		ANSICHAR* szSwitchState = TCHAR_TO_ANSI(in_pszSwitchState);
+	ANSICHAR* szString = TCHAR_TO_ANSI(in_pszString);
 #else
-		const WIDECHAR * szSwitchGroup = in_pszSwitchGroup;
-		const WIDECHAR * szSwitchState = in_pszSwitchState;
+	const WIDECHAR * szString = in_pszString;
 #endif
-		eResult = AK::SoundEngine::SetSwitch( szSwitchGroup, szSwitchState, GameObjID );
-	}
-	return eResult;
+	return AK::SoundEngine::GetIDFromString( szString );
 }
 	
 /**
@@ -1225,7 +1731,14 @@ AKRESULT FAkAudioDevice::SetOcclusionObstruction(
 
 	if ( m_bSoundEngineInitialized )
 	{
-		eResult = AK::SoundEngine::SetObjectObstructionAndOcclusion( gameObjId, in_ListenerIndex, in_Obstruction, in_Occlusion );
+		if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetObstructionOcclusion( gameObjId, in_ListenerIndex, in_Obstruction, in_Occlusion );
+		}
+		else
+		{
+			eResult = AK::SoundEngine::SetObjectObstructionAndOcclusion( gameObjId, in_ListenerIndex, in_Obstruction, in_Occlusion );
+		}
 	}
 
 	return eResult;
@@ -1246,7 +1759,14 @@ AKRESULT FAkAudioDevice::SetAuxSends(
 	AKRESULT eResult = AK_Success;
 	if ( m_bSoundEngineInitialized )
 	{
-		eResult = AK::SoundEngine::SetGameObjectAuxSendValues( in_GameObjId, in_AuxSendValues.GetData(), in_AuxSendValues.Num() );
+		if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetAuxSends( in_GameObjId, in_AuxSendValues.GetData(), in_AuxSendValues.Num() );
+		}
+		else
+		{
+			eResult = AK::SoundEngine::SetGameObjectAuxSendValues( in_GameObjId, in_AuxSendValues.GetData(), in_AuxSendValues.Num() );
+		}
 	}
 
 	return eResult;
@@ -1279,7 +1799,14 @@ void FAkAudioDevice::StopGameObject( UAkComponent * in_pComponent )
 	}
 	if ( m_bSoundEngineInitialized )
 	{
-		AK::SoundEngine::StopAll( gameObjId );
+		if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueStopAll( gameObjId );
+		}
+		else
+		{
+			AK::SoundEngine::StopAll( gameObjId );
+		}
 	}
 }
 
@@ -1292,7 +1819,14 @@ void FAkAudioDevice::StopPlayingID( AkPlayingID in_playingID )
 {
 	if ( m_bSoundEngineInitialized )
 	{
-		AK::SoundEngine::StopPlayingID( in_playingID );
+		if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueStopPlayingID( in_playingID );
+		}
+		else
+		{
+			AK::SoundEngine::StopPlayingID( in_playingID );
+		}
 	}
 }
 
@@ -1310,8 +1844,15 @@ void FAkAudioDevice::RegisterComponent( UAkComponent * in_pComponent )
 		parentActor = in_pComponent->GetOwner();
 	}
 
+	InvalidateAkComponentLookup( in_pComponent );
+	ParameterWriteCombiner.ForgetGameObject( (AkGameObjectID) in_pComponent );
+
 	if ( m_bSoundEngineInitialized )
 	{
+		// Registration is immediate: send what is pending first so that queued calls keep their
+		// order relative to the lifetime of the game object (component addresses can be reused).
+		FlushPendingCommands( (AkGameObjectID) in_pComponent );
+
 #ifndef AK_OPTIMIZED
 		if ( parentActor )
 		{
@@ -1333,91 +1874,152 @@ void FAkAudioDevice::RegisterComponent( UAkComponent * in_pComponent )
  */
 void FAkAudioDevice::UnregisterComponent( UAkComponent * in_pComponent )
 {
+	InvalidateAkComponentLookup( in_pComponent );
+	ParameterWriteCombiner.ForgetGameObject( (AkGameObjectID) in_pComponent );
+	LastPostTimes.Remove( (AkGameObjectID) in_pComponent );
+	PositionBatcher.Remove( in_pComponent );
+	ComponentManager.Remove( in_pComponent );
+
 	if ( m_bSoundEngineInitialized )
 	{
+		FlushPendingCommands( (AkGameObjectID) in_pComponent );
 		AK::SoundEngine::UnregisterGameObj( (AkGameObjectID) in_pComponent );
 	}
 }
 
-UAkComponent* FAkAudioDevice::GetAkComponent( class USceneComponent* AttachToComponent, FName AttachPointName, const FVector * Location, EAttachLocation::Type LocationType )
+/**
+ * Find a registered AkComponent that fits the attachment criteria. This is the uncached part of GetAkComponent.
+ */
+UAkComponent* FAkAudioDevice::FindAkComponent( class USceneComponent* AttachToComponent, FName AttachPointName, const FVector * Location, EAttachLocation::Type LocationType )
 {
-	check( AttachToComponent );
-
-	UAkComponent* AkComponent = NULL;
-
-	if( GEngine && AK::SoundEngine::IsInitialized())
+	AActor * Actor = AttachToComponent->GetOwner();
+	if( Actor ) 
 	{
-		AActor * Actor = AttachToComponent->GetOwner();
-		if( Actor ) 
+		TArray<UAkComponent*> AkComponents;
+		Actor->GetComponents(AkComponents);
+		for ( int32 CompIdx = 0; CompIdx < AkComponents.Num(); CompIdx++ )
 		{
-			if( Actor->IsPendingKill() )
+			UAkComponent* pCompI = AkComponents[CompIdx];
+			if ( pCompI && pCompI->IsRegistered() )
 			{
-				// Avoid creating component if we're trying to play a sound on an already destroyed actor.
-				return NULL;
-			}
+				if ( AttachToComponent == pCompI )
+				{
+					return pCompI;
+				}
 
-			TArray<UAkComponent*> AkComponents;
-			Actor->GetComponents(AkComponents);
-			for ( int32 CompIdx = 0; CompIdx < AkComponents.Num(); CompIdx++ )
-			{
-				UAkComponent* pCompI = AkComponents[CompIdx];
-				if ( pCompI && pCompI->IsRegistered() )
+				if ( AttachToComponent != pCompI->GetAttachParent() 
+					|| AttachPointName != pCompI->AttachSocketName )
 				{
-					if ( AttachToComponent == pCompI )
-					{
-						return pCompI;
-					}
+					continue;
+				}
 
-					if ( AttachToComponent != pCompI->GetAttachParent() 
-						|| AttachPointName != pCompI->AttachSocketName )
+				// If a location is requested, try to match location.
+				if ( Location )
+				{
+					if (LocationType == EAttachLocation::KeepWorldPosition)
 					{
-						continue;
+						if ( !FVector::PointsAreSame(*Location, pCompI->GetComponentLocation()) )
+							continue;
 					}
-
-					// If a location is requested, try to match location.
-					if ( Location )
+					else
 					{
-						if (LocationType == EAttachLocation::KeepWorldPosition)
-						{
-							if ( !FVector::PointsAreSame(*Location, pCompI->GetComponentLocation()) )
-								continue;
-						}
-						else
-						{
-							if ( !FVector::PointsAreSame(*Location, pCompI->RelativeLocation) )
-								continue;
-						}
+						if ( !FVector::PointsAreSame(*Location, pCompI->RelativeLocation) )
+							continue;
 					}
-
-					// AkComponent found which exactly matches the attachment: reuse it.
-					return pCompI;
 				}
+
+				// AkComponent found which exactly matches the attachment: reuse it.
+				return pCompI;
 			}
 		}
-		else
+	}
+	else
+	{
+		// Try to find if there is an AkComponent attached to AttachToComponent (will be the case if AttachToComponent has no owner)
+		for(int32 CompIdx = 0; CompIdx < AttachToComponent->AttachChildren.Num(); CompIdx++)
+		{
+			UAkComponent* pCompI = Cast<UAkComponent>(AttachToComponent->AttachChildren[CompIdx]);
+			if ( pCompI && pCompI->IsRegistered() )
+			{
+				// There is an associated AkComponent to AttachToComponent, no need to add another one.
+				return pCompI;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Remove the lookups that could resolve to an AkComponent from the GetAkComponent cache
+ *
+ * @param in_pComponent		Component being registered or unregistered
+ */
+void FAkAudioDevice::InvalidateAkComponentLookup( UAkComponent * in_pComponent )
+{
+	if ( in_pComponent && IsInGameThread() )
+	{
+		AkComponentLookupCache.Remove( FAkComponentLookupKey( in_pComponent, NAME_None ) );
+		if ( in_pComponent->GetAttachParent() )
+		{
+			AkComponentLookupCache.Remove( FAkComponentLookupKey( in_pComponent->GetAttachParent(), in_pComponent->AttachSocketName ) );
+		}
+	}
+}
+
+UAkComponent* FAkAudioDevice::GetAkComponent( class USceneComponent* AttachToComponent, FName AttachPointName, const FVector * Location, EAttachLocation::Type LocationType )
+{
+	check( AttachToComponent );
+
+	UAkComponent* AkComponent = NULL;
+
+	if( GEngine && AK::SoundEngine::IsInitialized())
+	{
+		AActor * Actor = AttachToComponent->GetOwner();
+		if( Actor && Actor->IsPendingKill() )
+		{
+			// Avoid creating component if we're trying to play a sound on an already destroyed actor.
+			return NULL;
+		}
+
+		// Lookups that are not constrained by a location are cached. A cached component is only
+		// returned if it still matches the attachment, which also covers components that were
+		// re-attached since the lookup was made.
+		const bool bUseLookupCache = ( Location == NULL ) && IsInGameThread();
+		const FAkComponentLookupKey LookupKey( AttachToComponent, AttachPointName );
+		if( bUseLookupCache )
 		{
-			// Try to find if there is an AkComponent attached to AttachToComponent (will be the case if AttachToComponent has no owner)
-			for(int32 CompIdx = 0; CompIdx < AttachToComponent->AttachChildren.Num(); CompIdx++)
+			const TWeakObjectPtr<UAkComponent>* CachedComponent = AkComponentLookupCache.Find( LookupKey );
+			if( CachedComponent )
 			{
-				UAkComponent* pCompI = Cast<UAkComponent>(AttachToComponent->AttachChildren[CompIdx]);
-				if ( pCompI && pCompI->IsRegistered() )
+				UAkComponent* pCompI = CachedComponent->Get();
+				if( pCompI && pCompI->IsRegistered() 
+					&& ( AttachToComponent == pCompI || ( AttachToComponent == pCompI->GetAttachParent() && AttachPointName == pCompI->AttachSocketName ) ) )
 				{
-					// There is an associated AkComponent to AttachToComponent, no need to add another one.
 					return pCompI;
 				}
+
+				AkComponentLookupCache.Remove( LookupKey );
 			}
 		}
 
-		if ( AkComponent == NULL )
+		AkComponent = FindAkComponent( AttachToComponent, AttachPointName, Location, LocationType );
+		if( AkComponent )
 		{
-			if( Actor )
-			{
-				AkComponent = NewObject<UAkComponent>(Actor);
-			}
-			else
+			if( bUseLookupCache )
 			{
-				AkComponent = NewObject<UAkComponent>();
+				AkComponentLookupCache.Add( LookupKey, AkComponent );
 			}
+			return AkComponent;
+		}
+
+		if( Actor )
+		{
+			AkComponent = NewObject<UAkComponent>(Actor);
+		}
+		else
+		{
+			AkComponent = NewObject<UAkComponent>();
 		}
 
 		check( AkComponent );
@@ -1436,6 +2038,11 @@ UAkComponent* FAkAudioDevice::GetAkComponent( class USceneComponent* AttachToCom
 
 		AkComponent->RegisterComponentWithWorld(AttachToComponent->GetWorld());
 		AkComponent->AttachTo(AttachToComponent, AttachPointName, LocationType);
+
+		if( bUseLookupCache )
+		{
+			AkComponentLookupCache.Add( LookupKey, AkComponent );
+		}
 	}
 
 	return( AkComponent );
@@ -1451,6 +2058,7 @@ void FAkAudioDevice::CancelEventCallbackCookie( void* in_cookie )
 {
 	if ( m_bSoundEngineInitialized )
 	{
+		PlayingIDRegistry.CancelCookie( in_cookie );
 		AK::SoundEngine::CancelEventCallbackCookie( in_cookie );
 	}
 }
@@ -1464,7 +2072,7 @@ AKRESULT FAkAudioDevice::SetAttenuationScalingFactor(AActor* Actor, float Scalin
 		eResult = GetGameObjectID( Actor, GameObjID );
 		if( eResult == AK_Success )
 		{
-			eResult = AK::SoundEngine::SetAttenuationScalingFactor(GameObjID, ScalingFactor);
+			eResult = SetAttenuationScalingFactor((UAkComponent*)GameObjID, ScalingFactor);
 		}
 	}
 
@@ -1476,7 +2084,25 @@ AKRESULT FAkAudioDevice::SetAttenuationScalingFactor(UAkComponent* AkComponent,
 	AKRESULT eResult = AK_Fail;
 	if ( m_bSoundEngineInitialized )
 	{
-		eResult = AK::SoundEngine::SetAttenuationScalingFactor((AkGameObjectID)AkComponent, ScalingFactor);
+		if ( AkComponent && AkComponent != (UAkComponent*)DUMMY_GAMEOBJ )
+		{
+			// Kept on the component, which sends it again when its game object is registered.
+			AkComponent->AttenuationScalingFactor = ScalingFactor;
+			if ( !AkComponent->IsGameObjectRegistered() )
+			{
+				return AK_Success;
+			}
+		}
+
+		if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetAttenuationScalingFactor((AkGameObjectID)AkComponent, ScalingFactor);
+			eResult = AK_Success;
+		}
+		else
+		{
+			eResult = AK::SoundEngine::SetAttenuationScalingFactor((AkGameObjectID)AkComponent, ScalingFactor);
+		}
 	}
 	return eResult;
 }
@@ -1752,11 +2378,76 @@ bool FAkAudioDevice::EnsureInitialized()
 	// Go get the max number of Aux busses
 	const UAkSettings* AkSettings = GetDefault<UAkSettings>();
 	MaxAuxBus = AK_MAX_AUX_PER_OBJ;
+	bComponentDormancy = false;
+	bAudibilityCulling = false;
+	AudibilityCullingMargin = 0.0f;
 	if( AkSettings )
 	{
 		MaxAuxBus = AkSettings->MaxSimultaneousReverbVolumes;
+		bComponentDormancy = AkSettings->bEnableComponentDormancy;
+		bAudibilityCulling = AkSettings->bEnableAudibilityCulling;
+		AudibilityCullingMargin = AkSettings->AudibilityCullingMargin;
+
+		if( AkSettings->bUseCommandQueue )
+		{
+			CommandQueue.Init( AkSettings->CommandQueueSize );
+		}
+
+		if( AkSettings->bCoalesceParameterWrites )
+		{
+			ParameterWriteCombiner.Init( AkSettings->RTPCCoalesceEpsilon );
+		}
+
+		if( AkSettings->bBatchPositionUpdates )
+		{
+			PositionBatcher.Init( AkSettings->PositionUpdateEpsilon, AkSettings->OrientationUpdateEpsilon );
+		}
+
+		if( AkSettings->bCentralizedComponentUpdate )
+		{
+			TArray<FAkComponentManager::FLODTier> LODTiers;
+			for( int32 TierIdx = 0; TierIdx < AkSettings->DistanceLODTiers.Num(); TierIdx++ )
+			{
+				const FAkDistanceLODTier& TierSettings = AkSettings->DistanceLODTiers[TierIdx];
+				FAkComponentManager::FLODTier Tier;
+				Tier.MaxDistance = TierSettings.MaxDistance;
+				Tier.PositionUpdateInterval = TierSettings.PositionUpdateInterval;
+				Tier.ReverbUpdateInterval = TierSettings.ReverbUpdateInterval;
+				Tier.OcclusionRefreshInterval = TierSettings.OcclusionRefreshInterval;
+				LODTiers.Add( Tier );
+			}
+			ComponentManager.Init( LODTiers, AkSettings->bParallelComponentUpdate );
+		}
+
+		ComponentPool.Init( AkSettings->ComponentPoolSize );
+
+		if( AkSettings->bLazyGameObjectRegistration )
+		{
+			GameObjectRegistrar.Init( AkSettings->GameObjectIdleTimeout );
+		}
+
+		if( AkSettings->bVirtualizeAmbientSounds )
+		{
+			AmbientVirtualizer.Init( AkSettings->AmbientVirtualizationHysteresis, AkSettings->AmbientVirtualizationInterval, AkSettings->bSeekRestartedAmbientSounds );
+		}
 	}
 
+	CallbackDispatcher.Init( AkSettings ? FMath::Max( AkSettings->CallbackQueueSize, 2 ) : 1024 );
+	if( AkSettings )
+	{
+		ImpactAggregator.Init( AkSettings->ImpactBucketSize, FMath::Max( AkSettings->MaxImpactsPerBucket, 1 ),
+			AkSettings->ImpactIntensityRTPC.IsEmpty() ? AK_INVALID_RTPC_ID : GetIDFromString( *AkSettings->ImpactIntensityRTPC ) );
+		CrowdAggregator.Init( AkSettings->CrowdCellSize, FMath::Max( AkSettings->MaxIndividualCrowdAgents, 0 ),
+			AkSettings->CrowdDensityRTPC.IsEmpty() ? AK_INVALID_RTPC_ID : GetIDFromString( *AkSettings->CrowdDensityRTPC ),
+			AkSettings->CrowdIntensityRTPC.IsEmpty() ? AK_INVALID_RTPC_ID : GetIDFromString( *AkSettings->CrowdIntensityRTPC ),
+			AkSettings->CrowdCellReleaseDelay );
+	}
+	else
+	{
+		ImpactAggregator.Init( 400.0f, 2, AK_INVALID_RTPC_ID );
+		CrowdAggregator.Init( 1500.0f, 8, AK_INVALID_RTPC_ID, AK_INVALID_RTPC_ID, 2.0f );
+	}
+	OneShotEmitterPool.Init( AkSettings ? FMath::Max( AkSettings->OneShotEmitterPoolSize, 0 ) : 64 );
 	
 	return true;
 }
@@ -1843,6 +2534,22 @@ AkPlayingID FAkAudioDevice::PostEventInternal(
 		AkCallbackFunc in_pfnCallback /*= NULL*/,	///< Callback function
 		void * in_pCookie /*= NULL*/				///< Callback cookie that will be sent to the callback function along with additional information.
         )
+{
+#ifndef AK_SUPPORT_WCHAR
+	ANSICHAR* szEvent = TCHAR_TO_ANSI(in_pszEvent);
+#else
+	const WIDECHAR * szEvent = in_pszEvent;
+#endif
+	return PostEventInternal( AK::SoundEngine::GetIDFromString(szEvent), in_pAkComponent, in_uFlags, in_pfnCallback, in_pCookie );
+}
+
+AkPlayingID FAkAudioDevice::PostEventInternal(
+		AkUniqueID in_EventID, 
+		class UAkComponent* in_pAkComponent, 
+		AkUInt32 in_uFlags /*= 0*/,					///< Bitmask: see \ref AkCallbackType
+		AkCallbackFunc in_pfnCallback /*= NULL*/,	///< Callback function
+		void * in_pCookie /*= NULL*/				///< Callback cookie that will be sent to the callback function along with additional information.
+        )
 {
 	if ( m_bSoundEngineInitialized )
 	{
@@ -1850,23 +2557,33 @@ AkPlayingID FAkAudioDevice::PostEventInternal(
 		if ( in_pAkComponent )
 		{
 			GameObjID = (AkGameObjectID)in_pAkComponent;
-			if( in_pAkComponent != (UAkComponent*)DUMMY_GAMEOBJ && in_pAkComponent->OcclusionRefreshInterval > 0.0f )
-			{
-				in_pAkComponent->CalculateOcclusionValues(false);
-			}
 		}
 
-#ifndef AK_SUPPORT_WCHAR
-		ANSICHAR* szEvent = TCHAR_TO_ANSI(in_pszEvent);
-#else
-		const WIDECHAR * szEvent = in_pszEvent;
-#endif
-		return AK::SoundEngine::PostEvent( szEvent, GameObjID, in_uFlags, in_pfnCallback, in_pCookie );
-	}
-	else
-	{
-		return AK_INVALID_PLAYING_ID;
+		// Waking up a dormant component computes its occlusion, unless it is up to date.
+		if( in_pAkComponent && in_pAkComponent != (UAkComponent*)DUMMY_GAMEOBJ && !in_pAkComponent->WakeFromDormancy()
+			&& in_pAkComponent->OcclusionRefreshInterval > 0.0f && !in_pAkComponent->IsOcclusionUpToDate() )
+		{
+			in_pAkComponent->CalculateOcclusionValues(false);
+		}
+
+		if( in_pAkComponent && in_pAkComponent != (UAkComponent*)DUMMY_GAMEOBJ )
+		{
+			ComponentManager.SubmitDeferredPosition( in_pAkComponent );
+			PositionBatcher.SubmitNow( *this, in_pAkComponent );
+		}
+
+		// Posts are sent right away so that the playing ID can be returned. Send what is pending first to keep ordering.
+		FlushPendingCommands( GameObjID );
+
+		// The event may set or reset RTPCs on its own: the next writes must not be dropped as repeats.
+		ParameterWriteCombiner.ForgetSubmittedRTPCs( GameObjID );
+		if( GameObjID != DUMMY_GAMEOBJ )
+		{
+			return PlayingIDRegistry.PostEvent( in_EventID, in_pAkComponent, in_uFlags, in_pfnCallback, in_pCookie ).PlayingID;
+		}
+		return PlayingIDRegistry.PostEvent( in_EventID, GameObjID, in_uFlags, in_pfnCallback, in_pCookie ).PlayingID;
 	}
+
 	return AK_INVALID_PLAYING_ID;
 }
 
@@ -1960,6 +2677,84 @@ void FAkAudioDevice::StopProfilerCapture()
 	}
 }
 
+/*------------------------------------------------------------------------------------
+	Statistics
+------------------------------------------------------------------------------------*/
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * Logs the counters of the device and of its helpers since they were last reset, and resets
+ * them if the first argument is "reset". Helpers that are disabled in the settings report zeros.
+ */
+static void DumpAkAudioStats( const TArray<FString>& in_Args )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if ( !AkAudioDevice )
+	{
+		return;
+	}
+
+	UE_LOG(LogAkAudio, Display, TEXT("AkAudio.DumpStats: posts: %u tested for audibility, %u culled, %u rejected by concurrency, %u instances stolen"),
+		AkAudioDevice->GetNumAudibilityTestedPosts(), AkAudioDevice->GetNumAudibilityCulledPosts(),
+		AkAudioDevice->GetNumConcurrencyRejectedPosts(), AkAudioDevice->GetNumConcurrencyStolenInstances() );
+	UE_LOG(LogAkAudio, Display, TEXT("AkAudio.DumpStats: overflows: %u command queue, %u callback dispatcher, %u one-shot emitter pool"),
+		AkAudioDevice->GetCommandQueue().GetNumOverflows(), AkAudioDevice->GetCallbackDispatcher().GetNumOverflows(),
+		AkAudioDevice->GetOneShotEmitterPool().GetNumOverflows() );
+
+	const FAkParameterWriteCombiner::FStats CombinerStats = AkAudioDevice->GetParameterWriteCombiner().GetStats();
+	UE_LOG(LogAkAudio, Display, TEXT("AkAudio.DumpStats: parameter writes: %u received, %u coalesced, %u dropped, %u submitted"),
+		CombinerStats.NumWrites, CombinerStats.NumCoalesced, CombinerStats.NumDropped, CombinerStats.NumSubmitted );
+
+	const FAkImpactAggregator::FStats ImpactStats = AkAudioDevice->GetImpactAggregator().GetStats();
+	UE_LOG(LogAkAudio, Display, TEXT("AkAudio.DumpStats: impacts: %u received, %u merged, %u posted"),
+		ImpactStats.NumImpacts, ImpactStats.NumMerged, ImpactStats.NumPosted );
+
+	const FAkPositionBatcher::FStats BatcherStats = AkAudioDevice->GetPositionBatcher().GetStats();
+	UE_LOG(LogAkAudio, Display, TEXT("AkAudio.DumpStats: batched positions: %u marked, %u submitted, %u skipped"),
+		BatcherStats.NumMarked, BatcherStats.NumSubmitted, BatcherStats.NumSkipped );
+
+	const FAkComponentManager::FStats ManagerStats = AkAudioDevice->GetComponentManager().GetStats();
+	UE_LOG(LogAkAudio, Display, TEXT("AkAudio.DumpStats: component manager: %u visited, %u updated, %u deferred, %u parallel batches"),
+		ManagerStats.NumVisited, ManagerStats.NumUpdated, ManagerStats.NumDeferred, ManagerStats.NumParallelBatches );
+
+	const FAkComponentPool::FStats PoolStats = AkAudioDevice->GetComponentPool().GetStats();
+	UE_LOG(LogAkAudio, Display, TEXT("AkAudio.DumpStats: component pool: %u hits, %u misses, %u returned, %u discarded"),
+		PoolStats.NumHits, PoolStats.NumMisses, PoolStats.NumReturned, PoolStats.NumDiscarded );
+
+	const FAkGameObjectRegistrar::FStats RegistrarStats = AkAudioDevice->GetGameObjectRegistrar().GetStats();
+	UE_LOG(LogAkAudio, Display, TEXT("AkAudio.DumpStats: lazy registration: %u deferred, %u registered, %u unregistered"),
+		RegistrarStats.NumDeferred, RegistrarStats.NumRegistered, RegistrarStats.NumUnregistered );
+
+	const FAkAmbientVirtualizer::FStats VirtualizerStats = AkAudioDevice->GetAmbientVirtualizer().GetStats();
+	UE_LOG(LogAkAudio, Display, TEXT("AkAudio.DumpStats: ambient virtualization: %u checked, %u virtualized, %u restarted"),
+		VirtualizerStats.NumChecked, VirtualizerStats.NumVirtualized, VirtualizerStats.NumRestarted );
+
+	const FAkCrowdAggregator::FStats CrowdStats = AkAudioDevice->GetCrowdAggregator().GetStats();
+	UE_LOG(LogAkAudio, Display, TEXT("AkAudio.DumpStats: crowds: %u cells started, %u cells released, %u agent events posted, %u dropped"),
+		CrowdStats.NumCellsStarted, CrowdStats.NumCellsReleased, CrowdStats.NumAgentEventsPosted, CrowdStats.NumAgentEventsDropped );
+
+	if ( in_Args.Num() > 0 && in_Args[0] == TEXT("reset") )
+	{
+		AkAudioDevice->GetParameterWriteCombiner().ResetStats();
+		AkAudioDevice->GetImpactAggregator().ResetStats();
+		AkAudioDevice->GetPositionBatcher().ResetStats();
+		AkAudioDevice->GetComponentManager().ResetStats();
+		AkAudioDevice->GetComponentPool().ResetStats();
+		AkAudioDevice->GetGameObjectRegistrar().ResetStats();
+		AkAudioDevice->GetAmbientVirtualizer().ResetStats();
+		AkAudioDevice->GetCrowdAggregator().ResetStats();
+	}
+}
+
+static FAutoConsoleCommandWithArgs DumpAkAudioStatsCommand(
+	TEXT("AkAudio.DumpStats"),
+	TEXT("Logs the counters of the Wwise audio device and of its helpers. Argument: reset, to reset them after logging."),
+	FConsoleCommandWithArgsDelegate::CreateStatic( &DumpAkAudioStats )
+	);
+
+#endif // !UE_BUILD_SHIPPING
+
 
 // end
 
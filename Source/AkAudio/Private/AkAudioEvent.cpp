@@ -18,6 +18,13 @@ UAkAudioEvent::UAkAudioEvent(const class FObjectInitializer& ObjectInitializer)
 {
 	// Properties
 	RequiredBank = NULL;
+	PlaybackType = EAkEventPlaybackType::Unknown;
+	MaxInstances = 0;
+	MaxInstancesPerGameObject = 0;
+	MinRetriggerInterval = 0.0f;
+	StealPolicy = EAkConcurrencyStealPolicy::None;
+	EventId = AK_INVALID_UNIQUE_ID;
+	UpdateEventId();
 }
 
 /**
@@ -26,6 +33,24 @@ UAkAudioEvent::UAkAudioEvent(const class FObjectInitializer& ObjectInitializer)
 void UAkAudioEvent::PostLoad()
 {
 	Super::PostLoad();
+	UpdateEventId();
+}
+
+/**
+ * Called after the event has been renamed, so that the cached ID follows the new name.
+ */
+void UAkAudioEvent::PostRename(UObject* OldOuter, const FName OldName)
+{
+	Super::PostRename(OldOuter, OldName);
+	UpdateEventId();
+}
+
+/**
+ * Refresh the cached Wwise ID from the current name of the event.
+ */
+void UAkAudioEvent::UpdateEventId()
+{
+	EventId = AK::SoundEngine::GetIDFromString(TCHAR_TO_ANSI(*GetName()));
 }
 
 /**
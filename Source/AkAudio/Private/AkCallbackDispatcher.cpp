@@ -0,0 +1,229 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkCallbackDispatcher.cpp: Delivery of sound engine callbacks on the game thread.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkCallbackDispatcher.h"
+
+/*------------------------------------------------------------------------------------
+	FAkCallbackDispatcher
+------------------------------------------------------------------------------------*/
+
+FAkCallbackDispatcher::FAkCallbackDispatcher()
+	: Slots(nullptr)
+	, Mask(0)
+	, EnqueuePos(0)
+	, DequeuePos(0)
+	, NextHandlerID(1)
+{
+}
+
+FAkCallbackDispatcher::~FAkCallbackDispatcher()
+{
+	delete[] Slots;
+	Slots = nullptr;
+}
+
+void FAkCallbackDispatcher::Init( uint32 in_uCapacity )
+{
+	check( Slots == nullptr );
+
+	const uint32 Capacity = FMath::RoundUpToPowerOfTwo( FMath::Max<uint32>( in_uCapacity, 2 ) );
+	Slots = new FSlot[Capacity];
+	Mask = Capacity - 1;
+	for( uint32 Idx = 0; Idx < Capacity; Idx++ )
+	{
+		Slots[Idx].Sequence = (int32)Idx;
+	}
+
+	EnqueuePos = 0;
+	DequeuePos = 0;
+	NumOverflows.Reset();
+}
+
+void FAkCallbackDispatcher::Term()
+{
+	delete[] Slots;
+	Slots = nullptr;
+	Mask = 0;
+
+	{
+		FScopeLock Lock(&OverflowCriticalSection);
+		OverflowPayloads.Empty();
+		NumPendingOverflows.Reset();
+	}
+
+	Handlers.Empty();
+}
+
+void * FAkCallbackDispatcher::RegisterHandler( const FAkGameThreadCallback& in_Handler )
+{
+	check( IsInGameThread() );
+
+	const uint32 HandlerID = NextHandlerID++;
+	Handlers.Add( HandlerID, in_Handler );
+	return HandlerIDToCookie( HandlerID );
+}
+
+void FAkCallbackDispatcher::UnregisterHandler( void * in_pCookie )
+{
+	check( IsInGameThread() );
+	Handlers.Remove( CookieToHandlerID( in_pCookie ) );
+}
+
+void FAkCallbackDispatcher::AudioThreadCallback( AkCallbackType in_eType, AkCallbackInfo* in_pCallbackInfo )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !AkAudioDevice )
+	{
+		return;
+	}
+
+	FAkCallbackPayload Payload;
+	FMemory::Memzero( Payload );
+	Payload.Type = in_eType;
+	Payload.GameObjID = in_pCallbackInfo->gameObjID;
+	Payload.HandlerID = CookieToHandlerID( in_pCallbackInfo->pCookie );
+
+	if( in_eType & AK_MusicSyncAll )
+	{
+		const AkMusicSyncCallbackInfo * MusicSyncInfo = (const AkMusicSyncCallbackInfo *)in_pCallbackInfo;
+		Payload.PlayingID = MusicSyncInfo->playingID;
+		Payload.MusicSync.BeatDuration = MusicSyncInfo->fBeatDuration;
+		Payload.MusicSync.BarDuration = MusicSyncInfo->fBarDuration;
+		Payload.MusicSync.GridDuration = MusicSyncInfo->fGridDuration;
+		Payload.MusicSync.GridOffset = MusicSyncInfo->fGridOffset;
+	}
+	else if( in_eType & ( AK_EndOfEvent | AK_EndOfDynamicSequenceItem | AK_Marker | AK_Duration ) )
+	{
+		const AkEventCallbackInfo * EventInfo = (const AkEventCallbackInfo *)in_pCallbackInfo;
+		Payload.PlayingID = EventInfo->playingID;
+		Payload.EventID = EventInfo->eventID;
+
+		if( in_eType == AK_Marker )
+		{
+			const AkMarkerCallbackInfo * MarkerInfo = (const AkMarkerCallbackInfo *)in_pCallbackInfo;
+			Payload.Marker.Identifier = MarkerInfo->uIdentifier;
+			Payload.Marker.Position = MarkerInfo->uPosition;
+		}
+		else if( in_eType == AK_Duration )
+		{
+			const AkDurationCallbackInfo * DurationInfo = (const AkDurationCallbackInfo *)in_pCallbackInfo;
+			Payload.Duration.Duration = DurationInfo->fDuration;
+			Payload.Duration.EstimatedDuration = DurationInfo->fEstimatedDuration;
+			Payload.Duration.AudioNodeID = DurationInfo->audioNodeID;
+		}
+	}
+
+	AkAudioDevice->GetCallbackDispatcher().Enqueue( Payload );
+}
+
+void FAkCallbackDispatcher::Enqueue( const FAkCallbackPayload& in_Payload )
+{
+	// Once a payload overflowed, the following ones go to the overflow list as well until it
+	// is delivered, so that notifications keep their order.
+	if( Slots && NumPendingOverflows.GetValue() == 0 )
+	{
+		int32 Pos = EnqueuePos;
+		for(;;)
+		{
+			FSlot* Slot = &Slots[(uint32)Pos & Mask];
+			const int32 Sequence = Slot->Sequence;
+			FPlatformMisc::MemoryBarrier();
+
+			const int32 Diff = (int32)((uint32)Sequence - (uint32)Pos);
+			if( Diff == 0 )
+			{
+				// The slot is free: try to claim it.
+				if( FPlatformAtomics::InterlockedCompareExchange( &EnqueuePos, (int32)((uint32)Pos + 1), Pos ) == Pos )
+				{
+					Slot->Payload = in_Payload;
+					FPlatformMisc::MemoryBarrier();
+					Slot->Sequence = (int32)((uint32)Pos + 1);
+					return;
+				}
+			}
+			else if( Diff < 0 )
+			{
+				// Full.
+				break;
+			}
+
+			Pos = EnqueuePos;
+		}
+	}
+
+	FScopeLock Lock(&OverflowCriticalSection);
+	OverflowPayloads.Add( in_Payload );
+	NumPendingOverflows.Increment();
+	NumOverflows.Increment();
+}
+
+bool FAkCallbackDispatcher::Dequeue( FAkCallbackPayload& out_Payload )
+{
+	if( !Slots )
+	{
+		return false;
+	}
+
+	FSlot& Slot = Slots[(uint32)DequeuePos & Mask];
+	const int32 Sequence = Slot.Sequence;
+	FPlatformMisc::MemoryBarrier();
+
+	if( (int32)((uint32)Sequence - ((uint32)DequeuePos + 1)) < 0 )
+	{
+		// Empty, or the producer that claimed this slot has not finished writing it yet.
+		return false;
+	}
+
+	out_Payload = Slot.Payload;
+	FPlatformMisc::MemoryBarrier();
+	Slot.Sequence = (int32)((uint32)DequeuePos + Mask + 1);
+	DequeuePos++;
+	return true;
+}
+
+uint32 FAkCallbackDispatcher::Dispatch()
+{
+	check( IsInGameThread() );
+
+	uint32 NumDelivered = 0;
+
+	// The handler is looked up and copied for every payload: it may unregister itself, or others.
+	FAkCallbackPayload Payload;
+	while( Dequeue(Payload) )
+	{
+		const FAkGameThreadCallback* Handler = Handlers.Find( Payload.HandlerID );
+		if( Handler )
+		{
+			FAkGameThreadCallback HandlerCopy = *Handler;
+			HandlerCopy.ExecuteIfBound( Payload );
+			NumDelivered++;
+		}
+	}
+
+	if( NumPendingOverflows.GetValue() != 0 )
+	{
+		TArray<FAkCallbackPayload> Overflowed;
+		{
+			FScopeLock Lock(&OverflowCriticalSection);
+			Exchange( Overflowed, OverflowPayloads );
+			NumPendingOverflows.Reset();
+		}
+
+		for( int32 Idx = 0; Idx < Overflowed.Num(); Idx++ )
+		{
+			const FAkGameThreadCallback* Handler = Handlers.Find( Overflowed[Idx].HandlerID );
+			if( Handler )
+			{
+				FAkGameThreadCallback HandlerCopy = *Handler;
+				HandlerCopy.ExecuteIfBound( Overflowed[Idx] );
+				NumDelivered++;
+			}
+		}
+	}
+
+	return NumDelivered;
+}
@@ -21,19 +21,6 @@
 	UAkComponent
 ------------------------------------------------------------------------------------*/
 
-static void AkComponentCallback( AkCallbackType in_eType, AkCallbackInfo* in_pCallbackInfo )
-{
-	UAkComponent * pObj = ( (UAkComponent *) in_pCallbackInfo->pCookie );
-	if( pObj )
-	{
-		pObj->NumActiveEvents.Decrement();
-		if( pObj->NumActiveEvents.GetValue() == 0 )
-		{
-			pObj->bFlaggedForDestroy = true;
-		}
-	}
-}
-
 UAkComponent::UAkComponent(const class FObjectInitializer& ObjectInitializer) :
 Super(ObjectInitializer)
 {
@@ -59,26 +46,43 @@ Super(ObjectInitializer)
 	AttenuationScalingFactor = 1.0f;
 	bAutoDestroy = false;
 	bFlaggedForDestroy = false;
-	NumActiveEvents.Reset();
+	NumActiveEvents = 0;
+	CallbackCookie = NULL;
+	bPositionDirty = false;
+	bHasSubmittedPosition = false;
+	ManagerWorld = NULL;
+	ManagerSlot = INDEX_NONE;
+	bDormant = false;
+	bPooled = false;
+	bGameObjectRegistered = false;
+	bKeepGameObjectRegistered = false;
+	IdleExpiryTime = 0.0;
+	ActiveListenerMask = 0;
+	bHasActiveListenerMask = false;
 }
 
 void UAkComponent::PostAssociatedAkEvent()
 {
-	if( AkAudioEvent )
-	{
-		PostAkEventByName(AkAudioEvent->GetName());
-	}
-	else
-	{
-		PostAkEventByName(EventName);
-	}
+	PostAkEvent(AkAudioEvent, EventName);
 }
 
 void UAkComponent::PostAkEvent( class UAkAudioEvent * AkEvent, const FString& in_EventName )
 {
 	if ( AkEvent )
 	{
-		PostAkEventByName(AkEvent->GetName());
+		FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+		if ( !IsInGameThread() )
+		{
+			// The audibility and the concurrency rules use game thread state: they apply when the game thread makes the post.
+			if ( AkAudioDevice )
+			{
+				AkAudioDevice->PostEventFromWorkerThread( this, AkEvent, AkEvent->GetEventId() );
+			}
+		}
+		else if ( !IsOutOfAudibleRange(AkEvent) && PassesConcurrencyRules(AkEvent) )
+		{
+			PostAkEventByID(AkEvent->GetEventId());
+		}
 	}
 	else
 	{
@@ -88,84 +92,344 @@ void UAkComponent::PostAkEvent( class UAkAudioEvent * AkEvent, const FString& in
 
 void UAkComponent::PostAkEventByName( const FString& in_EventName )
 {
-	UWorld* CurrentWorld = GetWorld();
-
 	if (in_EventName.IsEmpty())
 	{
 		UE_LOG(LogAkAudio, Warning, TEXT("AkComponent: Attempted to post an empty AkEvent name."));
 		return;
 	}
 
-	if ( CurrentWorld->AllowAudioPlayback() && FAkAudioDevice::Get() )
+	PostAkEventByID( FAkAudioDevice::GetIDFromString(*in_EventName) );
+}
+
+AkPlayingID UAkComponent::PostAkEventByID( AkUniqueID in_EventID )
+{
+	return (AkPlayingID)PostAkEventByIDWithHandle( in_EventID ).PlayingID;
+}
+
+FAkPlayingHandle UAkComponent::PostAkEventByIDWithHandle( AkUniqueID in_EventID, AkUInt32 in_uCallbackFlags )
+{
+	FAkPlayingHandle Handle;
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+
+	if ( AkAudioDevice && !IsInGameThread() )
 	{
-#ifndef AK_SUPPORT_WCHAR
-		ANSICHAR* szEventName = TCHAR_TO_ANSI(*in_EventName);
-#else
-		const WIDECHAR * szEventName = *in_EventName;
-#endif
-		if( OcclusionRefreshInterval > 0.0f )
+		// The world, the component, the registries and the traces belong to the game thread, which makes the post.
+		AkAudioDevice->PostEventFromWorkerThread( this, NULL, in_EventID, in_uCallbackFlags );
+		return Handle;
+	}
+
+	UWorld* CurrentWorld = GetWorld();
+	if ( CurrentWorld->AllowAudioPlayback() && AkAudioDevice )
+	{
+		// Waking up computes the occlusion, unless it is up to date.
+		if( !WakeFromDormancy() && OcclusionRefreshInterval > 0.0f && !IsOcclusionUpToDate() )
 		{
 			CalculateOcclusionValues(false);
 		}
 
-		if( bAutoDestroy )
+		// Posts are sent right away so that the playing ID can be returned. Send what is pending first to keep ordering.
+		AkAudioDevice->GetComponentManager().SubmitDeferredPosition( this );
+		AkAudioDevice->GetPositionBatcher().SubmitNow( *AkAudioDevice, this );
+		AkAudioDevice->FlushPendingCommands( (AkGameObjectID) this );
+		AkAudioDevice->GetParameterWriteCombiner().ForgetSubmittedRTPCs( (AkGameObjectID) this );
+
+		// The end of event is needed to auto destroy and to unregister idle game objects, and is broadcast whenever someone listens.
+		AkUInt32 CallbackFlags = in_uCallbackFlags;
+		if( bAutoDestroy || OnAkEventCallback.IsBound() || AkAudioDevice->GetGameObjectRegistrar().IsEnabled() )
+		{
+			CallbackFlags |= AK_EndOfEvent;
+		}
+
+		FAkPlayingIDRegistry& PlayingIDRegistry = AkAudioDevice->GetPlayingIDRegistry();
+		FAkPlayingIDRegistry::FHandle RegistryHandle;
+		if( CallbackFlags )
 		{
-			NumActiveEvents.Increment();
-			AK::SoundEngine::PostEvent( szEventName, (AkGameObjectID) this, AK_EndOfEvent, &AkComponentCallback, this);
+			RegistryHandle = PlayingIDRegistry.PostEvent( in_EventID, this, CallbackFlags, &FAkCallbackDispatcher::AudioThreadCallback, GetCallbackCookie() );
+			if( RegistryHandle.IsValid() && ( CallbackFlags & AK_EndOfEvent ) )
+			{
+				NumActiveEvents++;
+			}
 		}
 		else
 		{
-			AK::SoundEngine::PostEvent( szEventName, (AkGameObjectID) this );
+			RegistryHandle = PlayingIDRegistry.PostEvent( in_EventID, this );
+		}
+
+		Handle.PlayingID = (int32)RegistryHandle.PlayingID;
+		Handle.SlotIndex = (int32)RegistryHandle.Index;
+		Handle.Generation = (int32)RegistryHandle.Generation;
+	}
+
+	return Handle;
+}
+
+FAkPlayingHandle UAkComponent::PostAkEventWithCallbacks( class UAkAudioEvent * AkEvent, bool bMarkers, bool bDuration, bool bMusicSync )
+{
+	AkUInt32 CallbackFlags = AK_EndOfEvent;
+	CallbackFlags |= bMarkers ? AK_Marker : 0;
+	CallbackFlags |= bDuration ? AK_Duration : 0;
+	CallbackFlags |= bMusicSync ? AK_MusicSyncAll : 0;
+
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if ( AkEvent && AkAudioDevice && !IsInGameThread() )
+	{
+		// The concurrency rules apply when the game thread makes the post.
+		AkAudioDevice->PostEventFromWorkerThread( this, AkEvent, AkEvent->GetEventId(), CallbackFlags );
+		return FAkPlayingHandle();
+	}
+
+	// Always posted with callbacks, so never culled by audibility: the end of event must reach the listeners.
+	if ( !AkEvent || !PassesConcurrencyRules(AkEvent) )
+	{
+		return FAkPlayingHandle();
+	}
+
+	return PostAkEventByIDWithHandle( AkEvent->GetEventId(), CallbackFlags );
+}
+
+void * UAkComponent::GetCallbackCookie()
+{
+	if( CallbackCookie == NULL )
+	{
+		FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+		if( AkAudioDevice )
+		{
+			CallbackCookie = AkAudioDevice->GetCallbackDispatcher().RegisterHandler( FAkGameThreadCallback::CreateUObject( this, &UAkComponent::HandleAkCallback ) );
 		}
 	}
+	return CallbackCookie;
+}
+
+void UAkComponent::HandleAkCallback( const FAkCallbackPayload& in_Payload )
+{
+	FAkEventCallbackInfo CallbackInfo;
+	CallbackInfo.PlayingID = (int32)in_Payload.PlayingID;
+
+	switch( in_Payload.Type )
+	{
+	case AK_EndOfEvent:
+		CallbackInfo.CallbackType = EAkCallbackType::EndOfEvent;
+		break;
+	case AK_Marker:
+		CallbackInfo.CallbackType = EAkCallbackType::Marker;
+		CallbackInfo.MarkerIdentifier = (int32)in_Payload.Marker.Identifier;
+		CallbackInfo.MarkerPosition = (int32)in_Payload.Marker.Position;
+		break;
+	case AK_Duration:
+		CallbackInfo.CallbackType = EAkCallbackType::Duration;
+		CallbackInfo.Duration = in_Payload.Duration.Duration;
+		CallbackInfo.EstimatedDuration = in_Payload.Duration.EstimatedDuration;
+		break;
+	case AK_MusicSyncBeat:
+		CallbackInfo.CallbackType = EAkCallbackType::MusicSyncBeat;
+		break;
+	case AK_MusicSyncBar:
+		CallbackInfo.CallbackType = EAkCallbackType::MusicSyncBar;
+		break;
+	case AK_MusicSyncEntry:
+		CallbackInfo.CallbackType = EAkCallbackType::MusicSyncEntry;
+		break;
+	case AK_MusicSyncExit:
+		CallbackInfo.CallbackType = EAkCallbackType::MusicSyncExit;
+		break;
+	case AK_MusicSyncGrid:
+		CallbackInfo.CallbackType = EAkCallbackType::MusicSyncGrid;
+		break;
+	case AK_MusicSyncUserCue:
+		CallbackInfo.CallbackType = EAkCallbackType::MusicSyncUserCue;
+		break;
+	case AK_MusicSyncPoint:
+		CallbackInfo.CallbackType = EAkCallbackType::MusicSyncPoint;
+		break;
+	default:
+		break;
+	}
+
+	if( in_Payload.Type & AK_MusicSyncAll )
+	{
+		CallbackInfo.BeatDuration = in_Payload.MusicSync.BeatDuration;
+		CallbackInfo.BarDuration = in_Payload.MusicSync.BarDuration;
+	}
+
+	if( in_Payload.Type == AK_EndOfEvent && NumActiveEvents > 0 && --NumActiveEvents == 0 )
+	{
+		FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+		if( bAutoDestroy )
+		{
+			bFlaggedForDestroy = true;
+
+			if( AkAudioDevice )
+			{
+				AkAudioDevice->QueueAutoDestroy( this );
+			}
+		}
+		else if( AkAudioDevice && bGameObjectRegistered )
+		{
+			AkAudioDevice->GetGameObjectRegistrar().MarkIdle( this );
+		}
+	}
+
+	OnAkEventCallback.Broadcast( CallbackInfo );
+}
+
+FAkPlayingHandle UAkComponent::PostAkEventWithHandle( class UAkAudioEvent * AkEvent, const FString& in_EventName )
+{
+	if ( AkEvent )
+	{
+		FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+		if ( AkAudioDevice && !IsInGameThread() )
+		{
+			// The audibility and the concurrency rules apply when the game thread makes the post.
+			AkAudioDevice->PostEventFromWorkerThread( this, AkEvent, AkEvent->GetEventId() );
+			return FAkPlayingHandle();
+		}
+
+		return ( IsOutOfAudibleRange(AkEvent) || !PassesConcurrencyRules(AkEvent) ) ? FAkPlayingHandle() : PostAkEventByIDWithHandle(AkEvent->GetEventId());
+	}
+
+	if (in_EventName.IsEmpty())
+	{
+		UE_LOG(LogAkAudio, Warning, TEXT("AkComponent: Attempted to post an empty AkEvent name."));
+		return FAkPlayingHandle();
+	}
+
+	return PostAkEventByIDWithHandle( FAkAudioDevice::GetIDFromString(*in_EventName) );
+}
+
+static FAkPlayingIDRegistry::FHandle ToRegistryHandle( const FAkPlayingHandle& in_Handle )
+{
+	FAkPlayingIDRegistry::FHandle RegistryHandle;
+	RegistryHandle.PlayingID = (AkPlayingID)in_Handle.PlayingID;
+	RegistryHandle.Index = (uint32)in_Handle.SlotIndex;
+	RegistryHandle.Generation = (uint32)in_Handle.Generation;
+	return RegistryHandle;
+}
+
+void UAkComponent::StopPlayingHandle( const FAkPlayingHandle& Handle )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if ( AkAudioDevice )
+	{
+		AkPlayingID PlayingID = AkAudioDevice->GetPlayingIDRegistry().GetPlayingID( ToRegistryHandle(Handle) );
+		if ( PlayingID != AK_INVALID_PLAYING_ID )
+		{
+			AkAudioDevice->StopPlayingID( PlayingID );
+		}
+	}
+}
+
+bool UAkComponent::IsPlayingHandle( const FAkPlayingHandle& Handle ) const
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	return AkAudioDevice && AkAudioDevice->GetPlayingIDRegistry().IsPlaying( ToRegistryHandle(Handle) );
+}
+
+int32 UAkComponent::GetNumPlayingEvents() const
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	return AkAudioDevice ? (int32)AkAudioDevice->GetPlayingIDRegistry().GetNumPlaying( (AkGameObjectID) this ) : 0;
+}
+
+void UAkComponent::GetPlayingIDs( TArray<AkPlayingID>& out_PlayingIDs ) const
+{
+	out_PlayingIDs.Reset();
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if ( AkAudioDevice )
+	{
+		AkAudioDevice->GetPlayingIDRegistry().GetPlayingIDs( (AkGameObjectID) this, out_PlayingIDs );
+	}
 }
 
 void UAkComponent::Stop()
 {
-	if (  FAkAudioDevice::Get() )
+	// Nothing plays on a game object that is not registered.
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if ( AkAudioDevice && bGameObjectRegistered )
 	{
-		AK::SoundEngine::StopAll( (AkGameObjectID) this );
+		AkAudioDevice->StopGameObject( this );
 	}
 }
 
 void UAkComponent::SetRTPCValue( FString RTPC, float Value, int32 InterpolationTimeMs = 0)
 {
-	if ( FAkAudioDevice::Get() )
+	SetRTPCValueByID( FAkAudioDevice::GetIDFromName(FName(*RTPC)), Value, InterpolationTimeMs );
+}
+
+void UAkComponent::SetRTPCValueByID( AkRtpcID in_RtpcID, float Value, int32 InterpolationTimeMs )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if ( AkAudioDevice )
 	{
-#ifndef AK_SUPPORT_WCHAR
-		ANSICHAR* szRTPC = TCHAR_TO_ANSI(*RTPC);
-#else
-		const WIDECHAR * szRTPC = *RTPC;
-#endif
-		AK::SoundEngine::SetRTPCValue( szRTPC, Value, (AkGameObjectID) this, InterpolationTimeMs );
+		KeepGameObjectRegistered();
+
+		FAkParameterWriteCombiner& ParameterWriteCombiner = AkAudioDevice->GetParameterWriteCombiner();
+		FAkAudioCommandQueue& CommandQueue = AkAudioDevice->GetCommandQueue();
+		if ( ParameterWriteCombiner.IsEnabled() )
+		{
+			ParameterWriteCombiner.SetRTPCValue( in_RtpcID, Value, (AkGameObjectID) this, InterpolationTimeMs );
+		}
+		else if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetRTPCValue( in_RtpcID, Value, (AkGameObjectID) this, InterpolationTimeMs );
+		}
+		else
+		{
+			AK::SoundEngine::SetRTPCValue( in_RtpcID, Value, (AkGameObjectID) this, InterpolationTimeMs );
+		}
 	}
 }
 
 void UAkComponent::PostTrigger( FString Trigger )
 {
-	if ( FAkAudioDevice::Get() )
+	PostTriggerByID( FAkAudioDevice::GetIDFromName(FName(*Trigger)) );
+}
+
+void UAkComponent::PostTriggerByID( AkTriggerID in_TriggerID )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if ( AkAudioDevice )
 	{
-#ifndef AK_SUPPORT_WCHAR
-		ANSICHAR* szTrigger = TCHAR_TO_ANSI(*Trigger);
-#else
-		const WIDECHAR * szTrigger = *Trigger;
-#endif
-		AK::SoundEngine::PostTrigger( szTrigger, (AkGameObjectID) this );
+		WakeFromDormancy();
+
+		FAkAudioCommandQueue& CommandQueue = AkAudioDevice->GetCommandQueue();
+		AkAudioDevice->GetParameterWriteCombiner().FlushGameObject( (AkGameObjectID) this, CommandQueue );
+		if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueuePostTrigger( in_TriggerID, (AkGameObjectID) this );
+		}
+		else
+		{
+			AK::SoundEngine::PostTrigger( in_TriggerID, (AkGameObjectID) this );
+		}
 	}
 }
 
 void UAkComponent::SetSwitch( FString SwitchGroup, FString SwitchState )
 {
-	if ( FAkAudioDevice::Get() )
+	SetSwitchByID( FAkAudioDevice::GetIDFromName(FName(*SwitchGroup)), FAkAudioDevice::GetIDFromName(FName(*SwitchState)) );
+}
+
+void UAkComponent::SetSwitchByID( AkSwitchGroupID in_SwitchGroupID, AkSwitchStateID in_SwitchStateID )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if ( AkAudioDevice )
 	{
-#ifndef AK_SUPPORT_WCHAR
-		ANSICHAR* szSwitchGroup = TCHAR_TO_ANSI(*SwitchGroup);
-		ANSICHAR* szSwitchState = TCHAR_TO_ANSI(*SwitchState);
-#else
-		const WIDECHAR * szSwitchGroup = *SwitchGroup;
-		const WIDECHAR * szSwitchState = *SwitchState;
-#endif
-		AK::SoundEngine::SetSwitch( szSwitchGroup, szSwitchState, (AkGameObjectID) this );
+		KeepGameObjectRegistered();
+
+		FAkParameterWriteCombiner& ParameterWriteCombiner = AkAudioDevice->GetParameterWriteCombiner();
+		FAkAudioCommandQueue& CommandQueue = AkAudioDevice->GetCommandQueue();
+		if ( ParameterWriteCombiner.IsEnabled() )
+		{
+			ParameterWriteCombiner.SetSwitch( in_SwitchGroupID, in_SwitchStateID, (AkGameObjectID) this );
+		}
+		else if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetSwitch( in_SwitchGroupID, in_SwitchStateID, (AkGameObjectID) this );
+		}
+		else
+		{
+			AK::SoundEngine::SetSwitch( in_SwitchGroupID, in_SwitchStateID, (AkGameObjectID) this );
+		}
 	}
 }
 
@@ -176,9 +440,29 @@ void UAkComponent::SetStopWhenOwnerDestroyed( bool bStopWhenOwnerDestroyed )
 
 void UAkComponent::SetActiveListeners( int32 ListenerMask )
 {
-	if ( FAkAudioDevice::Get() )
+	// Sent again if the game object is registered later.
+	ActiveListenerMask = ListenerMask;
+	bHasActiveListenerMask = true;
+	if ( bGameObjectRegistered )
+	{
+		SendActiveListeners();
+	}
+}
+
+void UAkComponent::SendActiveListeners()
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if ( AkAudioDevice )
 	{
-		AK::SoundEngine::SetActiveListeners( (AkGameObjectID) this, ListenerMask );
+		FAkAudioCommandQueue& CommandQueue = AkAudioDevice->GetCommandQueue();
+		if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetActiveListeners( (AkGameObjectID) this, ActiveListenerMask );
+		}
+		else
+		{
+			AK::SoundEngine::SetActiveListeners( (AkGameObjectID) this, ActiveListenerMask );
+		}
 	}
 }
 
@@ -187,6 +471,18 @@ void UAkComponent::UseReverbVolumes(bool inUseReverbVolumes)
 	bUseReverbVolumes = inUseReverbVolumes;
 }
 
+bool UAkComponent::IsOutOfAudibleRange( const UAkAudioEvent * in_pEvent ) const
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	return AkAudioDevice && AkAudioDevice->IsOutOfAudibleRange( in_pEvent, GetComponentLocation(), AttenuationScalingFactor );
+}
+
+bool UAkComponent::PassesConcurrencyRules( const UAkAudioEvent * in_pEvent )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	return !AkAudioDevice || AkAudioDevice->ApplyConcurrencyRules( in_pEvent, (AkGameObjectID) this, GetWorld() );
+}
+
 float UAkComponent::GetAttenuationRadius() const
 { 
 	if( AkAudioEvent )
@@ -200,15 +496,48 @@ float UAkComponent::GetAttenuationRadius() const
 
 void UAkComponent::OnRegister()
 {
-	RegisterGameObject(); // Done before parent so that OnUpdateTransform follows registration and updates position correctly.
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !bGameObjectRegistered && AkAudioDevice && AkAudioDevice->GetGameObjectRegistrar().IsEnabled() )
+	{
+		// Registered on first use. Dormant until then, so that nothing is sent for it.
+		bDormant = true;
+		AkAudioDevice->GetGameObjectRegistrar().OnRegistrationDeferred();
+	}
+	else
+	{
+		RegisterGameObject(); // Done before parent so that OnUpdateTransform follows registration and updates position correctly.
+	}
 
 	Super::OnRegister();
 
+	AddToComponentManager();
+
 #if WITH_EDITORONLY_DATA
 	UpdateSpriteTexture();
 #endif
 }
 
+void UAkComponent::AddToComponentManager()
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( AkAudioDevice && AkAudioDevice->GetComponentManager().IsEnabled() && CanBeManaged() && IsRegistered() && GetWorld() )
+	{
+		AkAudioDevice->GetComponentManager().Add( this );
+		SetComponentTickEnabled( false );
+	}
+}
+
+void UAkComponent::RegisterComponentTickFunctions(bool bRegister)
+{
+	Super::RegisterComponentTickFunctions( bRegister );
+
+	// Registering the tick function enables it again.
+	if( bRegister && ( bDormant || FAkComponentManager::IsManaged( this ) ) )
+	{
+		SetComponentTickEnabled( false );
+	}
+}
+
 #if WITH_EDITORONLY_DATA
 void UAkComponent::UpdateSpriteTexture()
 {
@@ -225,6 +554,12 @@ void UAkComponent::OnUnregister()
 	// Route OnUnregister event.
 	Super::OnUnregister();
 
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( AkAudioDevice )
+	{
+		AkAudioDevice->GetComponentManager().Remove( this );
+	}
+
 	// Don't stop audio and clean up component if owner has been destroyed (default behaviour). This function gets
 	// called from AActor::ClearComponents when an actor gets destroyed which is not usually what we want for one-
 	// shot sounds.
@@ -256,8 +591,9 @@ void UAkComponent::ShutdownAfterError( void )
 	Super::ShutdownAfterError();
 }
 
-void UAkComponent::ApplyAkReverbVolumeList(float DeltaTime)
+bool UAkComponent::AdvanceAkReverbVolumeFades(float DeltaTime)
 {
+	bool bIsFading = false;
 	if( CurrentAkReverbVolumes.Num() > 0 )
 	{
 		// Fade control
@@ -265,6 +601,7 @@ void UAkComponent::ApplyAkReverbVolumeList(float DeltaTime)
 		{
 			if( CurrentAkReverbVolumes[Idx].CurrentControlValue != CurrentAkReverbVolumes[Idx].TargetControlValue || CurrentAkReverbVolumes[Idx].bIsFadingOut )
 			{
+				bIsFading = true;
 				float Increment = ComputeFadeIncrement(DeltaTime, CurrentAkReverbVolumes[Idx].FadeRate, CurrentAkReverbVolumes[Idx].TargetControlValue);
 				if( CurrentAkReverbVolumes[Idx].bIsFadingOut )
 				{
@@ -307,24 +644,35 @@ void UAkComponent::ApplyAkReverbVolumeList(float DeltaTime)
 		}
 	}
 
-	TArray<AkAuxSendValue> AkReverbVolumes;
-	AkAuxSendValue	TmpSendValue;
-	AkReverbVolumes.Empty();
+	return bIsFading;
+}
 
+void UAkComponent::GetAuxSendValues( TArray<AkAuxSendValue>& out_AuxSends, int32 in_iMaxAuxBus ) const
+{
 	// Build a list to set as AuxBusses
+	out_AuxSends.Reset();
+	AkAuxSendValue	TmpSendValue;
+	for( int32 Idx = 0; Idx < CurrentAkReverbVolumes.Num() && Idx < in_iMaxAuxBus; Idx++ )
+	{
+		TmpSendValue.auxBusID = CurrentAkReverbVolumes[Idx].AuxBusId;
+		TmpSendValue.fControlValue = CurrentAkReverbVolumes[Idx].CurrentControlValue;
+		out_AuxSends.Add(TmpSendValue);
+	}
+}
+
+bool UAkComponent::ApplyAkReverbVolumeList(float DeltaTime)
+{
+	const bool bIsFading = AdvanceAkReverbVolumeFades(DeltaTime);
+
 	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
 	if( AkAudioDevice )
 	{
-		for( int32 Idx = 0; Idx < CurrentAkReverbVolumes.Num() && Idx < AkAudioDevice->GetMaxAuxBus(); Idx++ )
-		{
-			TmpSendValue.auxBusID = CurrentAkReverbVolumes[Idx].AuxBusId;
-			TmpSendValue.fControlValue = CurrentAkReverbVolumes[Idx].CurrentControlValue;
-			AkReverbVolumes.Add(TmpSendValue);
-		}
-
+		TArray<AkAuxSendValue> AkReverbVolumes;
+		GetAuxSendValues( AkReverbVolumes, AkAudioDevice->GetMaxAuxBus() );
 		AkAudioDevice->SetAuxSends((AkGameObjectID) this, AkReverbVolumes);
 	}
 
+	return bIsFading;
 }
 
 void UAkComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
@@ -333,13 +681,14 @@ void UAkComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FAct
 	{
 		Super::TickComponent( DeltaTime, TickType, ThisTickFunction );
 
+		bool bIsFadingReverbVolumes = false;
 		FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
 		if( AkAudioDevice )
 		{
 			// Update AkReverbVolume fade in/out
 			if( bUseReverbVolumes && AkAudioDevice->GetMaxAuxBus() > 0 )
 			{
-				ApplyAkReverbVolumeList(DeltaTime);
+				bIsFadingReverbVolumes = ApplyAkReverbVolumeList(DeltaTime);
 			}
 		}
 
@@ -349,47 +698,256 @@ void UAkComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FAct
 			SetOcclusion(DeltaTime);
 		}
 
-		if( bAutoDestroy && bFlaggedForDestroy )
+		if( !bIsFadingReverbVolumes && !IsOcclusionFading() && !IsOcclusionTracePending() )
 		{
-			if( NumActiveEvents.GetValue() == 0 )
-			{
-				DestroyComponent();
-			}
-			else
-			{
-				bFlaggedForDestroy = false;
-			}
+			TryEnterDormancy();
 		}
 	}
 }
 
-
-void UAkComponent::Activate(bool bReset)
+void UAkComponent::DestroyOrReturnToPool()
 {
-	Super::Activate( bReset );
-
-	UpdateGameObjectPosition();
-
-	// If spawned inside AkReverbVolume(s), we do not want the fade in effect to kick in.
-	UpdateAkReverbVolumeList(GetComponentLocation());
-	for( int32 Idx = 0; Idx < CurrentAkReverbVolumes.Num(); Idx++ )
-	{
-		CurrentAkReverbVolumes[Idx].CurrentControlValue = CurrentAkReverbVolumes[Idx].TargetControlValue;
-	}
-
-	FAkAudioDevice * AudioDevice = FAkAudioDevice::Get();
-	if (AudioDevice)
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !AkAudioDevice || !AkAudioDevice->GetComponentPool().Release( this ) )
 	{
-		AudioDevice->SetAttenuationScalingFactor(this, AttenuationScalingFactor);
+		DestroyComponent();
 	}
 }
 
-void UAkComponent::OnUpdateTransform(bool bSkipPhysicsMove, ETeleportType Teleport)
+void UAkComponent::ResetForPool()
 {
-	Super::OnUpdateTransform(bSkipPhysicsMove, Teleport);
-
-	UpdateGameObjectPosition();
-}
+	Deactivate();
+	DetachFromParent();
+
+	const UAkComponent * Defaults = GetDefault<UAkComponent>();
+	AkAudioEvent = NULL;
+	EventName.Empty();
+	StopWhenOwnerDestroyed = Defaults->StopWhenOwnerDestroyed;
+	AttenuationScalingFactor = Defaults->AttenuationScalingFactor;
+	OcclusionRefreshInterval = Defaults->OcclusionRefreshInterval;
+	bUseReverbVolumes = Defaults->bUseReverbVolumes;
+	bAutoDestroy = false;
+	bFlaggedForDestroy = false;
+	bDormant = false;
+	bKeepGameObjectRegistered = false;
+	bHasActiveListenerMask = false;
+	OnAkEventCallback.Clear();
+	CurrentAkReverbVolumes.Empty();
+	ListenerOcclusionInfo.Empty();
+	LastOcclusionRefresh = -1;
+
+	// The RTPCs, switches, sends, occlusion and active listeners set on the game object go away with it.
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( AkAudioDevice )
+	{
+		AkAudioDevice->UnregisterComponent( this );
+		bGameObjectRegistered = false;
+		if( AkAudioDevice->GetGameObjectRegistrar().IsEnabled() )
+		{
+			bDormant = true;
+		}
+		else
+		{
+			RegisterGameObject();
+		}
+	}
+}
+
+bool UAkComponent::TryEnterDormancy()
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( bDormant || !AkAudioDevice || !AkAudioDevice->IsComponentDormancyEnabled() || NumActiveEvents > 0 || NumDeferredPosts.GetValue() > 0 || bFlaggedForDestroy )
+	{
+		return false;
+	}
+
+	if( AkAudioDevice->GetPlayingIDRegistry().GetNumPlaying( (AkGameObjectID) this ) > 0 )
+	{
+		return false;
+	}
+
+	bDormant = true;
+
+	// The component manager keeps dormant components, but skips them.
+	if( !FAkComponentManager::IsManaged( this ) )
+	{
+		SetComponentTickEnabled( false );
+	}
+	return true;
+}
+
+bool UAkComponent::TryUnregisterIdleGameObject()
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !AkAudioDevice || NumActiveEvents > 0 || NumDeferredPosts.GetValue() > 0 || bFlaggedForDestroy )
+	{
+		return false;
+	}
+
+	if( AkAudioDevice->GetPlayingIDRegistry().GetNumPlaying( (AkGameObjectID) this ) > 0 )
+	{
+		return false;
+	}
+
+	return ReleaseGameObject();
+}
+
+bool UAkComponent::ReleaseGameObject()
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !bGameObjectRegistered || bKeepGameObjectRegistered || !AkAudioDevice )
+	{
+		return false;
+	}
+
+	// Unregistering removes the component from the manager: it is added back, and skipped while dormant.
+	const bool bWasManaged = FAkComponentManager::IsManaged( this );
+	bDormant = true;
+	AkAudioDevice->UnregisterComponent( this );
+	bGameObjectRegistered = false;
+
+	if( bWasManaged )
+	{
+		AddToComponentManager();
+	}
+	else
+	{
+		SetComponentTickEnabled( false );
+	}
+	return true;
+}
+
+bool UAkComponent::EnsureGameObjectRegistered()
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( bGameObjectRegistered || !AkAudioDevice )
+	{
+		return false;
+	}
+
+	RegisterGameObject();
+
+	// A new game object has the default listeners and scaling. The position, aux sends and occlusion are sent on wake up.
+	if( bHasActiveListenerMask )
+	{
+		SendActiveListeners();
+	}
+	AkAudioDevice->SetAttenuationScalingFactor( this, AttenuationScalingFactor );
+
+	AkAudioDevice->GetGameObjectRegistrar().OnRegisteredLazily( this );
+	return true;
+}
+
+void UAkComponent::KeepGameObjectRegistered()
+{
+	bKeepGameObjectRegistered = true;
+	EnsureGameObjectRegistered();
+}
+
+bool UAkComponent::WakeFromDormancy()
+{
+	if( !bDormant )
+	{
+		return false;
+	}
+
+	bDormant = false;
+
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( AkAudioDevice )
+	{
+		EnsureGameObjectRegistered();
+
+		// The transform was not followed while dormant.
+		UpdateGameObjectPosition();
+		AkAudioDevice->GetPositionBatcher().SubmitNow( *AkAudioDevice, this );
+
+		// Neither were the reverb volumes: jump to their current send levels.
+		if( bUseReverbVolumes && AkAudioDevice->GetMaxAuxBus() > 0 )
+		{
+			for( int32 Idx = CurrentAkReverbVolumes.Num() - 1; Idx >= 0; Idx-- )
+			{
+				if( CurrentAkReverbVolumes[Idx].bIsFadingOut )
+				{
+					CurrentAkReverbVolumes.RemoveAt(Idx);
+				}
+				else
+				{
+					CurrentAkReverbVolumes[Idx].CurrentControlValue = CurrentAkReverbVolumes[Idx].TargetControlValue;
+				}
+			}
+			ApplyAkReverbVolumeList(0.f);
+		}
+
+		// Computed right away when stale, so that the event does not start unoccluded behind a wall.
+		if( OcclusionRefreshInterval > 0.0f && !IsOcclusionUpToDate() )
+		{
+			CalculateOcclusionValues(false);
+		}
+	}
+
+	if( FAkComponentManager::IsManaged( this ) )
+	{
+		AddToComponentManager();
+	}
+	else
+	{
+		SetComponentTickEnabled( true );
+	}
+	return true;
+}
+
+
+void UAkComponent::Activate(bool bReset)
+{
+	// A component waiting for its first use stays dormant: registering it wakes it up and sends the rest.
+	const bool bWaitingForRegistration = bDormant && !bGameObjectRegistered;
+	if( !bWaitingForRegistration )
+	{
+		WakeFromDormancy();
+	}
+
+	Super::Activate( bReset );
+
+	// Activation enables the tick again, and resets the work done by the manager.
+	AddToComponentManager();
+
+	if( bWaitingForRegistration )
+	{
+		if( !FAkComponentManager::IsManaged( this ) )
+		{
+			SetComponentTickEnabled( false );
+		}
+		return;
+	}
+
+	UpdateGameObjectPosition();
+
+	// If spawned inside AkReverbVolume(s), we do not want the fade in effect to kick in.
+	UpdateAkReverbVolumeList(GetReverbVolumeQueryPosition());
+	for( int32 Idx = 0; Idx < CurrentAkReverbVolumes.Num(); Idx++ )
+	{
+		CurrentAkReverbVolumes[Idx].CurrentControlValue = CurrentAkReverbVolumes[Idx].TargetControlValue;
+	}
+
+	FAkAudioDevice * AudioDevice = FAkAudioDevice::Get();
+	if (AudioDevice)
+	{
+		AudioDevice->SetAttenuationScalingFactor(this, AttenuationScalingFactor);
+	}
+}
+
+void UAkComponent::OnUpdateTransform(bool bSkipPhysicsMove, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(bSkipPhysicsMove, Teleport);
+
+	// Dormant components catch up when they wake up. Far components may send their position later.
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !bDormant && !( AkAudioDevice && AkAudioDevice->GetComponentManager().OnComponentMoved( this ) ) )
+	{
+		UpdateGameObjectPosition();
+	}
+}
 
 void UAkComponent::RegisterGameObject()
 {
@@ -397,6 +955,7 @@ void UAkComponent::RegisterGameObject()
 	if ( AkAudioDevice )
 	{
 		AkAudioDevice->RegisterComponent( this );
+		bGameObjectRegistered = true;
 	}
 }
 
@@ -406,10 +965,18 @@ void UAkComponent::UnregisterGameObject()
 	if ( AkAudioDevice )
 	{
 		AkAudioDevice->UnregisterComponent( this );
+		bGameObjectRegistered = false;
 
-		if(bAutoDestroy)
+		if( CallbackCookie )
 		{
-			AkAudioDevice->CancelEventCallbackCookie(this);
+			AkAudioDevice->CancelEventCallbackCookie( CallbackCookie );
+			if( IsInGameThread() )
+			{
+				// Otherwise the handler stays registered, but is bound weakly and will not be called.
+				AkAudioDevice->GetCallbackDispatcher().UnregisterHandler( CallbackCookie );
+			}
+			CallbackCookie = NULL;
+			NumActiveEvents = 0;
 		}
 	}
 }
@@ -498,6 +1065,12 @@ void UAkComponent::UpdateAkReverbVolumeList( FVector Loc )
 		}
 	}
 
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( AkAudioDevice && FAkComponentManager::IsManaged( this ) )
+	{
+		AkAudioDevice->GetComponentManager().MarkReverbVolumesDirty( this );
+	}
+
 	// Fade out the current volumes not found in the new list
 	for( int32 Idx = 0; Idx < CurrentAkReverbVolumes.Num(); Idx++ )
 	{
@@ -512,26 +1085,96 @@ void UAkComponent::UpdateAkReverbVolumeList( FVector Loc )
 void UAkComponent::UpdateGameObjectPosition()
 {
 	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
-	if ( bIsActive && AkAudioDevice )
+	if ( bIsActive && bGameObjectRegistered && AkAudioDevice )
 	{
+		FAkPositionBatcher& PositionBatcher = AkAudioDevice->GetPositionBatcher();
+		if ( PositionBatcher.IsEnabled() && IsInGameThread() )
+		{
+			// Submitted once per frame from FAkAudioDevice::Update, or before the next post on this component.
+			PositionBatcher.MarkDirty( this );
+			return;
+		}
+
 		AkSoundPosition soundpos;
 		FAkAudioDevice::FVectorToAKVector( ComponentToWorld.GetTranslation(), soundpos.Position );
 		FAkAudioDevice::FVectorToAKVector( ComponentToWorld.GetUnitAxis( EAxis::X ), soundpos.Orientation );
-		AK::SoundEngine::SetPosition( (AkGameObjectID) this, soundpos );
+		FAkAudioCommandQueue& CommandQueue = AkAudioDevice->GetCommandQueue();
+		if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetPosition( (AkGameObjectID) this, soundpos );
+		}
+		else
+		{
+			AK::SoundEngine::SetPosition( (AkGameObjectID) this, soundpos );
+		}
 
-		// Find and apply all AkReverbVolumes at this location
-		if( bUseReverbVolumes && AkAudioDevice->GetMaxAuxBus() > 0 )
+		UpdateReverbVolumesAtPosition();
+	}
+}
+
+void UAkComponent::SetGameObjectPositions( const FVector * in_pPositions, int32 in_iNumPositions, AK::SoundEngine::MultiPositionType in_eType )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if ( !bIsActive || !bGameObjectRegistered || !AkAudioDevice || in_iNumPositions <= 0 )
+	{
+		return;
+	}
+
+	AkVector Orientation;
+	FAkAudioDevice::FVectorToAKVector( ComponentToWorld.GetUnitAxis( EAxis::X ), Orientation );
+
+	TArray<AkSoundPosition, TInlineAllocator<4> > SoundPositions;
+	SoundPositions.SetNumUninitialized( FMath::Min( in_iNumPositions, (int32)MAX_uint16 ) );
+	for( int32 Idx = 0; Idx < SoundPositions.Num(); Idx++ )
+	{
+		FAkAudioDevice::FVectorToAKVector( in_pPositions[Idx], SoundPositions[Idx].Position );
+		SoundPositions[Idx].Orientation = Orientation;
+	}
+
+	if( SoundPositions.Num() == 1 )
+	{
+		FAkAudioCommandQueue& CommandQueue = AkAudioDevice->GetCommandQueue();
+		if ( CommandQueue.IsEnabled() )
+		{
+			CommandQueue.EnqueueSetPosition( (AkGameObjectID) this, SoundPositions[0] );
+		}
+		else
 		{
-			UpdateAkReverbVolumeList( GetComponentLocation() );
+			AK::SoundEngine::SetPosition( (AkGameObjectID) this, SoundPositions[0] );
 		}
 	}
+	else
+	{
+		// The command queue only holds single positions: send the ones still pending first, so that none of them
+		// lands after this call and collapses the emitter to a single point.
+		AkAudioDevice->GetPositionBatcher().SubmitNow( *AkAudioDevice, this );
+		AkAudioDevice->FlushPendingCommands( (AkGameObjectID) this );
+		AK::SoundEngine::SetMultiplePositions( (AkGameObjectID) this, SoundPositions.GetData(), (AkUInt16)SoundPositions.Num(), in_eType );
+	}
+}
+
+void UAkComponent::UpdateReverbVolumesAtPosition()
+{
+	// Find and apply all AkReverbVolumes at this location
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( bUseReverbVolumes && bGameObjectRegistered && AkAudioDevice && AkAudioDevice->GetMaxAuxBus() > 0 )
+	{
+		UpdateAkReverbVolumeList( GetReverbVolumeQueryPosition() );
+	}
 }
 
 const float UAkComponent::OCCLUSION_FADE_RATE = 2.0f; // from 0.0 to 1.0 in 0.5 seconds
 void UAkComponent::SetOcclusion(const float DeltaTime)
+{
+	SendOcclusionValues( AdvanceOcclusionFades( DeltaTime ) );
+	RefreshOcclusionIfDue();
+}
+
+uint32 UAkComponent::AdvanceOcclusionFades(const float DeltaTime)
 {
 	// Fade the active occlusions
-	for(int32 ListenerIdx = 0; ListenerIdx < ListenerOcclusionInfo.Num(); ListenerIdx++)
+	uint32 FadedListeners = 0;
+	for(int32 ListenerIdx = 0; ListenerIdx < ListenerOcclusionInfo.Num() && ListenerIdx < 32; ListenerIdx++)
 	{
 		if( ListenerOcclusionInfo[ListenerIdx].CurrentValue != ListenerOcclusionInfo[ListenerIdx].TargetValue )
 		{
@@ -545,13 +1188,37 @@ void UAkComponent::SetOcclusion(const float DeltaTime)
 				maxVal
 				);
 
-			FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
-			if( AkAudioDevice )
-			{
-				AkAudioDevice->SetOcclusionObstruction(this, ListenerIdx, 0.0f, ListenerOcclusionInfo[ListenerIdx].CurrentValue);
-			}
+			FadedListeners |= 1u << ListenerIdx;
+		}
+	}
+	return FadedListeners;
+}
+
+void UAkComponent::SendOcclusionValues(uint32 in_uListenerMask)
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !AkAudioDevice )
+	{
+		return;
+	}
+
+	for(int32 ListenerIdx = 0; in_uListenerMask != 0; ListenerIdx++, in_uListenerMask >>= 1)
+	{
+		if( in_uListenerMask & 1 )
+		{
+			AkAudioDevice->SetOcclusionObstruction(this, ListenerIdx, 0.0f, ListenerOcclusionInfo[ListenerIdx].CurrentValue);
 		}
 	}
+}
+
+void UAkComponent::RefreshOcclusionIfDue()
+{
+	// Async trace results only live for the frame after the traces started, so pending ones are consumed first.
+	if( IsOcclusionTracePending() )
+	{
+		ConsumeOcclusionTraces();
+		return;
+	}
 
 	// Compute occlusion only when needed.
 	// Have to have "LastOcclutionRefresh == -1" because GetWorld() might return nullptr in UAkComponent's constructor,
@@ -561,13 +1228,249 @@ void UAkComponent::SetOcclusion(const float DeltaTime)
 		return;
 	}
 
-	CalculateOcclusionValues(true);
+	StartOcclusionTraces();
+}
+
+bool UAkComponent::IsOcclusionFading() const
+{
+	for( int32 ListenerIdx = 0; ListenerIdx < ListenerOcclusionInfo.Num(); ListenerIdx++ )
+	{
+		if( ListenerOcclusionInfo[ListenerIdx].CurrentValue != ListenerOcclusionInfo[ListenerIdx].TargetValue )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool UAkComponent::IsOcclusionTracePending() const
+{
+	for( int32 ListenerIdx = 0; ListenerIdx < ListenerOcclusionInfo.Num(); ListenerIdx++ )
+	{
+		if( ListenerOcclusionInfo[ListenerIdx].TraceStage != OTS_Idle )
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool UAkComponent::IsOcclusionUpToDate() const
+{
+	if( IsOcclusionTracePending() )
+	{
+		return true;
+	}
+
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( LastOcclusionRefresh == -1 || !AkAudioDevice || ListenerOcclusionInfo.Num() < AkAudioDevice->GetNumListeners() )
+	{
+		return false;
+	}
+	return (GetWorld()->GetTimeSeconds() - LastOcclusionRefresh) < OcclusionRefreshInterval;
+}
+
+const FCollisionQueryParams& UAkComponent::UpdateOcclusionQueryParams()
+{
+	static FName NAME_SoundOcclusion = FName(TEXT("SoundOcclusion"));
+
+	APlayerController* PlayerController = World->GetFirstPlayerController();
+	APawn* ActorToIgnore = NULL;
+	if( PlayerController != NULL )
+	{
+		ActorToIgnore = PlayerController->GetPawn();
+	}
+
+	// Only the ignored pawn changes; clearing keeps the ignored component array allocated.
+	OcclusionQueryParams.TraceTag = NAME_SoundOcclusion;
+	OcclusionQueryParams.bTraceComplex = true;
+	OcclusionQueryParams.ClearIgnoredComponents();
+	if( ActorToIgnore != NULL )
+	{
+		OcclusionQueryParams.AddIgnoredActor(ActorToIgnore);
+	}
+	return OcclusionQueryParams;
+}
+
+/**
+ * Translate the impact point of the direct occlusion path to the bounding box of the obstacle it hit
+ *
+ * @param in_Hit			Blocking hit of the direct path
+ * @param out_BoundingBox	Bounding box of the obstacle
+ * @param out_Points		The NUM_OCCLUSION_POINTS points through which the secondary paths go
+ */
+static void ComputeOcclusionPoints( const FHitResult& in_Hit, FBox& out_BoundingBox, FVector* out_Points )
+{
+	out_BoundingBox = FBox(0);
+	if( in_Hit.Actor.IsValid() )
+	{
+		out_BoundingBox = in_Hit.Actor->GetComponentsBoundingBox();
+	}
+	else if( in_Hit.Component.IsValid() )
+	{
+		out_BoundingBox = in_Hit.Component->Bounds.GetBox();
+	}
+
+	const FBox& BoundingBox = out_BoundingBox;
+	out_Points[0] = FVector(in_Hit.ImpactPoint.X, BoundingBox.Min.Y, BoundingBox.Min.Z);
+	out_Points[1] = FVector(in_Hit.ImpactPoint.X, BoundingBox.Min.Y, BoundingBox.Max.Z);
+	out_Points[2] = FVector(in_Hit.ImpactPoint.X, BoundingBox.Max.Y, BoundingBox.Min.Z);
+	out_Points[3] = FVector(in_Hit.ImpactPoint.X, BoundingBox.Max.Y, BoundingBox.Max.Z);
+
+	out_Points[4] = FVector(BoundingBox.Min.X, in_Hit.ImpactPoint.Y, BoundingBox.Min.Z);
+	out_Points[5] = FVector(BoundingBox.Min.X, in_Hit.ImpactPoint.Y, BoundingBox.Max.Z);
+	out_Points[6] = FVector(BoundingBox.Max.X, in_Hit.ImpactPoint.Y, BoundingBox.Min.Z);
+	out_Points[7] = FVector(BoundingBox.Max.X, in_Hit.ImpactPoint.Y, BoundingBox.Max.Z);
+
+	out_Points[8] = FVector(BoundingBox.Min.X, BoundingBox.Min.Y, in_Hit.ImpactPoint.Z);
+	out_Points[9] = FVector(BoundingBox.Min.X, BoundingBox.Max.Y, in_Hit.ImpactPoint.Z);
+	out_Points[10] = FVector(BoundingBox.Max.X, BoundingBox.Min.Y, in_Hit.ImpactPoint.Z);
+	out_Points[11] = FVector(BoundingBox.Max.X, BoundingBox.Max.Y, in_Hit.ImpactPoint.Z);
+}
+
+/** Result of an asynchronous occlusion trace */
+enum EAsyncOcclusionTraceResult
+{
+	AOTR_NotReady,
+	AOTR_Blocked,
+	AOTR_Clear,
+	/** The result expired, or the trace was never started */
+	AOTR_Lost,
+};
+
+/**
+ * Get the result of an asynchronous occlusion trace
+ *
+ * @param in_World		World the trace was started in
+ * @param in_Handle		Handle of the trace
+ * @param io_Datum		Scratch datum, reused across queries to keep its hit array
+ * @param out_Hit		Blocking hit, if any
+ */
+static EAsyncOcclusionTraceResult QueryOcclusionTrace( UWorld* in_World, const FTraceHandle& in_Handle, FTraceDatum& io_Datum, FHitResult* out_Hit = NULL )
+{
+	if( !in_World->QueryTraceData( in_Handle, io_Datum ) )
+	{
+		return in_World->IsTraceHandleValid( in_Handle, false ) ? AOTR_NotReady : AOTR_Lost;
+	}
+
+	if( io_Datum.OutHits.Num() > 0 && io_Datum.OutHits[0].bBlockingHit )
+	{
+		if( out_Hit )
+		{
+			*out_Hit = io_Datum.OutHits[0];
+		}
+		return AOTR_Blocked;
+	}
+	return AOTR_Clear;
+}
+
+void UAkComponent::StartOcclusionTraces()
+{
+	LastOcclusionRefresh = GetWorld()->GetTimeSeconds();
+
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !AkAudioDevice )
+	{
+		return;
+	}
+
+	const int32 NumListeners = AkAudioDevice->GetNumListeners();
+	if( ListenerOcclusionInfo.Num() < NumListeners )
+	{
+		ListenerOcclusionInfo.AddDefaulted( NumListeners - ListenerOcclusionInfo.Num() );
+	}
+
+	const FCollisionQueryParams& QueryParams = UpdateOcclusionQueryParams();
+	for(int32 ListenerIdx = 0; ListenerIdx < NumListeners; ListenerIdx++)
+	{
+		FAkListenerOcclusion& Occlusion = ListenerOcclusionInfo[ListenerIdx];
+		Occlusion.ListenerPosition = AkAudioDevice->GetListenerPosition(ListenerIdx);
+		Occlusion.SourcePosition = GetOcclusionSourcePosition(Occlusion.ListenerPosition);
+		Occlusion.DirectTrace = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Occlusion.SourcePosition, Occlusion.ListenerPosition, ECC_Visibility, QueryParams);
+		Occlusion.TraceStage = OTS_Direct;
+	}
+}
+
+void UAkComponent::ConsumeOcclusionTraces()
+{
+	FTraceDatum& Datum = OcclusionTraceDatum;
+	bool bQueryParamsSet = false;
+
+	for(int32 ListenerIdx = 0; ListenerIdx < ListenerOcclusionInfo.Num(); ListenerIdx++)
+	{
+		FAkListenerOcclusion& Occlusion = ListenerOcclusionInfo[ListenerIdx];
+
+		if( Occlusion.TraceStage == OTS_Direct )
+		{
+			FHitResult Hit;
+			const EAsyncOcclusionTraceResult Result = QueryOcclusionTrace( World, Occlusion.DirectTrace, Datum, &Hit );
+			if( Result == AOTR_NotReady )
+			{
+				continue;
+			}
+
+			// A lost result keeps the previous target until the next refresh.
+			Occlusion.TraceStage = OTS_Idle;
+			if( Result == AOTR_Clear )
+			{
+				Occlusion.TargetValue = 0.0f;
+			}
+			else if( Result == AOTR_Blocked )
+			{
+				if( !bQueryParamsSet )
+				{
+					UpdateOcclusionQueryParams();
+					bQueryParamsSet = true;
+				}
+
+				FBox BoundingBox;
+				ComputeOcclusionPoints( Hit, BoundingBox, OcclusionPoints );
+				for(int32 PointIdx = 0; PointIdx < NUM_OCCLUSION_POINTS; PointIdx++)
+				{
+					Occlusion.SecondaryTraces[2 * PointIdx] = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Occlusion.ListenerPosition, OcclusionPoints[PointIdx], ECC_Visibility, OcclusionQueryParams);
+					Occlusion.SecondaryTraces[2 * PointIdx + 1] = World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Occlusion.SourcePosition, OcclusionPoints[PointIdx], ECC_Visibility, OcclusionQueryParams);
+				}
+				Occlusion.TraceStage = OTS_Secondary;
+			}
+		}
+		else if( Occlusion.TraceStage == OTS_Secondary )
+		{
+			// The secondary traces all started on the same frame, so they complete, or expire, together.
+			const EAsyncOcclusionTraceResult FirstResult = QueryOcclusionTrace( World, Occlusion.SecondaryTraces[0], Datum );
+			if( FirstResult == AOTR_NotReady )
+			{
+				continue;
+			}
+
+			// Expired after a hitch, a pause or a long tick interval: keep the previous target until the next refresh.
+			if( FirstResult == AOTR_Lost )
+			{
+				Occlusion.TraceStage = OTS_Idle;
+				continue;
+			}
+
+			// Compute the number of "second order paths" that are also obstructed. This will allow us to approximate
+			// "how obstructed" the source is.
+			int32 NumObstructedPaths = 0;
+			for(int32 PointIdx = 0; PointIdx < NUM_OCCLUSION_POINTS; PointIdx++)
+			{
+				if( QueryOcclusionTrace( World, Occlusion.SecondaryTraces[2 * PointIdx], Datum ) == AOTR_Blocked
+					|| QueryOcclusionTrace( World, Occlusion.SecondaryTraces[2 * PointIdx + 1], Datum ) == AOTR_Blocked )
+				{
+					NumObstructedPaths++;
+				}
+			}
+
+			// Modulate occlusion by blocked secondary paths. 
+			Occlusion.TargetValue = (float)NumObstructedPaths / (float)NUM_OCCLUSION_POINTS;
+			Occlusion.TraceStage = OTS_Idle;
+		}
+	}
 }
 
 void UAkComponent::CalculateOcclusionValues(bool CalledFromTick)
 {
 	LastOcclusionRefresh = GetWorld()->GetTimeSeconds();
-	static FName NAME_SoundOcclusion = FName(TEXT("SoundOcclusion"));
 
 	int32 NumListeners = 0;
 	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
@@ -576,6 +1479,8 @@ void UAkComponent::CalculateOcclusionValues(bool CalledFromTick)
 		NumListeners = AkAudioDevice->GetNumListeners();
 	}
 
+	const FCollisionQueryParams& QueryParams = UpdateOcclusionQueryParams();
+	FVector* Points = OcclusionPoints;
 	for(int32 ListenerIdx = 0; ListenerIdx < NumListeners; ListenerIdx++)
 	{
 		FHitResult OutHit;
@@ -585,59 +1490,31 @@ void UAkComponent::CalculateOcclusionValues(bool CalledFromTick)
 			ListenerOcclusionInfo.Add(FAkListenerOcclusion());
 		}
 
+		// The values computed here supersede those of the pending traces.
+		ListenerOcclusionInfo[ListenerIdx].TraceStage = OTS_Idle;
+
 		FVector ListenerPosition;
 		AkAudioDevice = FAkAudioDevice::Get();
 		if( AkAudioDevice )
 		{
 			ListenerPosition = AkAudioDevice->GetListenerPosition(ListenerIdx);
 		}
-		FVector SourcePosition = GetComponentLocation();
-		APlayerController* PlayerController = World->GetFirstPlayerController();
-		APawn* ActorToIgnore = NULL;
-		if( PlayerController != NULL )
-		{
-			ActorToIgnore = PlayerController->GetPawn();
-		}
+		FVector SourcePosition = GetOcclusionSourcePosition(ListenerPosition);
 
-		bool bNowOccluded = GetWorld()->LineTraceSingleByChannel(OutHit, SourcePosition, ListenerPosition, ECC_Visibility, FCollisionQueryParams(NAME_SoundOcclusion, true, ActorToIgnore));
+		bool bNowOccluded = GetWorld()->LineTraceSingleByChannel(OutHit, SourcePosition, ListenerPosition, ECC_Visibility, QueryParams);
 		if( bNowOccluded )
 		{
 			FBox BoundingBox;
-
-			if( OutHit.Actor.IsValid() )
-			{
-				BoundingBox = OutHit.Actor->GetComponentsBoundingBox();
-			}
-			else if( OutHit.Component.IsValid() )
-			{
-				BoundingBox = OutHit.Component->Bounds.GetBox();
-			}
-
-			// Translate the impact point to the bounding box of the obstacle
-			TArray<FVector> Points;
-			Points.Add(FVector(OutHit.ImpactPoint.X, BoundingBox.Min.Y, BoundingBox.Min.Z));
-			Points.Add(FVector(OutHit.ImpactPoint.X, BoundingBox.Min.Y, BoundingBox.Max.Z));
-			Points.Add(FVector(OutHit.ImpactPoint.X, BoundingBox.Max.Y, BoundingBox.Min.Z));
-			Points.Add(FVector(OutHit.ImpactPoint.X, BoundingBox.Max.Y, BoundingBox.Max.Z));
-
-			Points.Add(FVector(BoundingBox.Min.X, OutHit.ImpactPoint.Y, BoundingBox.Min.Z));
-			Points.Add(FVector(BoundingBox.Min.X, OutHit.ImpactPoint.Y, BoundingBox.Max.Z));
-			Points.Add(FVector(BoundingBox.Max.X, OutHit.ImpactPoint.Y, BoundingBox.Min.Z));
-			Points.Add(FVector(BoundingBox.Max.X, OutHit.ImpactPoint.Y, BoundingBox.Max.Z));
-
-			Points.Add(FVector(BoundingBox.Min.X, BoundingBox.Min.Y, OutHit.ImpactPoint.Z));
-			Points.Add(FVector(BoundingBox.Min.X, BoundingBox.Max.Y, OutHit.ImpactPoint.Z));
-			Points.Add(FVector(BoundingBox.Max.X, BoundingBox.Min.Y, OutHit.ImpactPoint.Z));
-			Points.Add(FVector(BoundingBox.Max.X, BoundingBox.Max.Y, OutHit.ImpactPoint.Z));
+			ComputeOcclusionPoints( OutHit, BoundingBox, Points );
 				
 			// Compute the number of "second order paths" that are also obstructed. This will allow us to approximate
 			// "how obstructed" the source is.
 			int32 NumObstructedPaths = 0;
-			for(int32 PointIdx = 0; PointIdx < Points.Num(); PointIdx++)
+			for(int32 PointIdx = 0; PointIdx < NUM_OCCLUSION_POINTS; PointIdx++)
 			{
 				FHitResult TempHit;
-				bool bListenerToObstacle = GetWorld()->LineTraceSingleByChannel(TempHit, ListenerPosition, Points[PointIdx], ECC_Visibility, FCollisionQueryParams(NAME_SoundOcclusion, true, ActorToIgnore));
-				bool bSourceToObstacle = GetWorld()->LineTraceSingleByChannel(TempHit, SourcePosition, Points[PointIdx], ECC_Visibility, FCollisionQueryParams(NAME_SoundOcclusion, true, ActorToIgnore));
+				bool bListenerToObstacle = GetWorld()->LineTraceSingleByChannel(TempHit, ListenerPosition, Points[PointIdx], ECC_Visibility, QueryParams);
+				bool bSourceToObstacle = GetWorld()->LineTraceSingleByChannel(TempHit, SourcePosition, Points[PointIdx], ECC_Visibility, QueryParams);
 				if(bListenerToObstacle || bSourceToObstacle)
 				{
 					NumObstructedPaths++;
@@ -645,7 +1522,7 @@ void UAkComponent::CalculateOcclusionValues(bool CalledFromTick)
 			}
 
 			// Modulate occlusion by blocked secondary paths. 
-			ListenerOcclusionInfo[ListenerIdx].TargetValue = (float)NumObstructedPaths / (float)Points.Num();
+			ListenerOcclusionInfo[ListenerIdx].TargetValue = (float)NumObstructedPaths / (float)NUM_OCCLUSION_POINTS;
 
 #define AK_DEBUG_OCCLUSION 0
 #if AK_DEBUG_OCCLUSION
@@ -658,7 +1535,7 @@ void UAkComponent::CalculateOcclusionValues(bool CalledFromTick)
 			::DrawDebugPoint(GetWorld(), SourcePosition, 10.0f, FColor(0, 255, 0), false, 4);
 			::DrawDebugPoint(GetWorld(), OutHit.ImpactPoint, 10.0f, FColor(0, 255, 0), false, 4);
 
-			for(int32 i = 0; i < Points.Num(); i++)
+			for(int32 i = 0; i < NUM_OCCLUSION_POINTS; i++)
 			{
 				::DrawDebugPoint(GetWorld(), Points[i], 10.0f, FColor(255, 255, 0), false, 4);
 				::DrawDebugString(GetWorld(), Points[i], FString::Printf(TEXT("%d"), i), nullptr, FColor::White, 4);
@@ -0,0 +1,704 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkComponentManager.cpp: Central per-frame update of the AkComponents.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "AkComponentManager.h"
+#include "ParallelFor.h"
+
+/** How often the occlusion refresh interval of a component without occlusion is read again, in seconds */
+static const float OCCLUSION_RECHECK_INTERVAL = 1.0f;
+
+/** Number of work items computed by one task of the parallel update */
+static const int32 PARALLEL_BATCH_SIZE = 64;
+
+/*------------------------------------------------------------------------------------
+	FAkComponentManager
+------------------------------------------------------------------------------------*/
+
+FAkComponentManager::FAkComponentManager()
+	: NumWorkItems(0)
+	, bParallelUpdate(false)
+	, bEnabled(false)
+{
+	FMemory::Memzero( Stats );
+}
+
+void FAkComponentManager::Init( const TArray<FLODTier>& in_LODTiers, bool in_bParallelUpdate )
+{
+	LODTiers = in_LODTiers;
+	LODTiers.Sort( []( const FLODTier& A, const FLODTier& B ) { return A.MaxDistance < B.MaxDistance; } );
+	check( LODTiers.Num() <= 256 );
+
+	LODTierMaxDistancesSquared.Reset();
+	for( int32 TierIdx = 0; TierIdx < LODTiers.Num(); TierIdx++ )
+	{
+		LODTierMaxDistancesSquared.Add( FMath::Square( LODTiers[TierIdx].MaxDistance ) );
+	}
+
+	bParallelUpdate = in_bParallelUpdate;
+	bEnabled = true;
+}
+
+void FAkComponentManager::Term()
+{
+	for( TMap<UWorld*, FWorldComponents>::TIterator It(Worlds); It; ++It )
+	{
+		TArray<UAkComponent*>& Components = It.Value().Components;
+		for( int32 Slot = 0; Slot < Components.Num(); Slot++ )
+		{
+			Components[Slot]->ManagerWorld = NULL;
+			Components[Slot]->ManagerSlot = INDEX_NONE;
+		}
+	}
+	Worlds.Empty();
+	LODTiers.Empty();
+	LODTierMaxDistancesSquared.Empty();
+	DistancesSquared.Empty();
+	WorkItems.Empty();
+	NumWorkItems = 0;
+	bParallelUpdate = false;
+	bEnabled = false;
+}
+
+void FAkComponentManager::Add( UAkComponent * in_pComponent )
+{
+	Remove( in_pComponent );
+
+	UWorld * World = in_pComponent->GetWorld();
+	FWorldComponents& WorldComponents = Worlds.FindOrAdd( World );
+
+	in_pComponent->ManagerWorld = World;
+	in_pComponent->ManagerSlot = WorldComponents.Components.Add( in_pComponent );
+
+	// Send the reverb volumes, and compute the occlusion, on the next update. Dormant components are skipped until they wake up.
+	const float WorldTime = World->GetTimeSeconds();
+	WorldComponents.Flags.Add( in_pComponent->bDormant ? 0 : CF_ReverbVolumes );
+	WorldComponents.NextOcclusionTimes.Add( in_pComponent->bDormant ? MAX_FLT : 0.0f );
+
+	const FVector Position = in_pComponent->GetComponentLocation();
+	WorldComponents.PositionsX.Add( Position.X );
+	WorldComponents.PositionsY.Add( Position.Y );
+	WorldComponents.PositionsZ.Add( Position.Z );
+
+	WorldComponents.LODTiers.Add( 0 );
+	WorldComponents.LastPositionTimes.Add( WorldTime );
+	WorldComponents.LastReverbTimes.Add( WorldTime );
+}
+
+void FAkComponentManager::Remove( UAkComponent * in_pComponent )
+{
+	int32 Slot;
+	FWorldComponents * WorldComponents = FindWorldComponents( in_pComponent, Slot );
+	if( WorldComponents == NULL )
+	{
+		return;
+	}
+
+	// Move the last component into the freed slot.
+	WorldComponents->Components.RemoveAtSwap( Slot, 1, false );
+	WorldComponents->Flags.RemoveAtSwap( Slot, 1, false );
+	WorldComponents->NextOcclusionTimes.RemoveAtSwap( Slot, 1, false );
+	WorldComponents->PositionsX.RemoveAtSwap( Slot, 1, false );
+	WorldComponents->PositionsY.RemoveAtSwap( Slot, 1, false );
+	WorldComponents->PositionsZ.RemoveAtSwap( Slot, 1, false );
+	WorldComponents->LODTiers.RemoveAtSwap( Slot, 1, false );
+	WorldComponents->LastPositionTimes.RemoveAtSwap( Slot, 1, false );
+	WorldComponents->LastReverbTimes.RemoveAtSwap( Slot, 1, false );
+	if( Slot < WorldComponents->Components.Num() )
+	{
+		WorldComponents->Components[Slot]->ManagerSlot = Slot;
+	}
+
+	if( WorldComponents->Components.Num() == 0 )
+	{
+		Worlds.Remove( in_pComponent->ManagerWorld );
+	}
+
+	in_pComponent->ManagerWorld = NULL;
+	in_pComponent->ManagerSlot = INDEX_NONE;
+}
+
+bool FAkComponentManager::IsManaged( const UAkComponent * in_pComponent )
+{
+	return in_pComponent->ManagerSlot != INDEX_NONE;
+}
+
+void FAkComponentManager::MarkReverbVolumesDirty( UAkComponent * in_pComponent )
+{
+	int32 Slot;
+	FWorldComponents * WorldComponents = FindWorldComponents( in_pComponent, Slot );
+	if( WorldComponents && !( WorldComponents->Flags[Slot] & CF_ReverbVolumes ) )
+	{
+		// The fades start now, whenever the LOD tier lets them be applied.
+		WorldComponents->Flags[Slot] |= CF_ReverbVolumes;
+		WorldComponents->LastReverbTimes[Slot] = in_pComponent->ManagerWorld->GetTimeSeconds();
+	}
+}
+
+bool FAkComponentManager::OnComponentMoved( UAkComponent * in_pComponent )
+{
+	int32 Slot;
+	FWorldComponents * WorldComponents = FindWorldComponents( in_pComponent, Slot );
+	if( WorldComponents == NULL )
+	{
+		return false;
+	}
+
+	const FVector Position = in_pComponent->GetComponentLocation();
+	WorldComponents->PositionsX[Slot] = Position.X;
+	WorldComponents->PositionsY[Slot] = Position.Y;
+	WorldComponents->PositionsZ[Slot] = Position.Z;
+
+	if( GetLODTier( *WorldComponents, Slot ).PositionUpdateInterval <= 0.0f )
+	{
+		return false;
+	}
+
+	WorldComponents->Flags[Slot] |= CF_Position;
+	return true;
+}
+
+void FAkComponentManager::SubmitDeferredPosition( UAkComponent * in_pComponent )
+{
+	int32 Slot;
+	FWorldComponents * WorldComponents = FindWorldComponents( in_pComponent, Slot );
+	if( WorldComponents && ( WorldComponents->Flags[Slot] & CF_Position ) )
+	{
+		WorldComponents->Flags[Slot] &= ~CF_Position;
+		WorldComponents->LastPositionTimes[Slot] = in_pComponent->ManagerWorld->GetTimeSeconds();
+		in_pComponent->UpdateGameObjectPosition();
+	}
+}
+
+uint32 FAkComponentManager::Update( const TArray<FVector>& in_Listeners )
+{
+	uint32 NumUpdated = 0;
+
+	for( TMap<UWorld*, FWorldComponents>::TIterator It(Worlds); It; ++It )
+	{
+		// A world's entry goes away with its last component, so the worlds in the map are alive.
+		UWorld * World = It.Key();
+		if( World->IsPaused() )
+		{
+			continue;
+		}
+
+		NumUpdated += UpdateComponents( It.Value(), World->GetTimeSeconds(), World->GetDeltaSeconds(), in_Listeners );
+	}
+
+	return NumUpdated;
+}
+
+uint32 FAkComponentManager::UpdateWorld( UWorld * in_pWorld, float in_fDeltaTime, const TArray<FVector>& in_Listeners )
+{
+	FWorldComponents * WorldComponents = Worlds.Find( in_pWorld );
+	if( WorldComponents == NULL )
+	{
+		return 0;
+	}
+
+	return UpdateComponents( *WorldComponents, in_pWorld->GetTimeSeconds(), in_fDeltaTime, in_Listeners );
+}
+
+int32 FAkComponentManager::GetNumComponents() const
+{
+	int32 NumComponents = 0;
+	for( TMap<UWorld*, FWorldComponents>::TConstIterator It(Worlds); It; ++It )
+	{
+		NumComponents += It.Value().Components.Num();
+	}
+	return NumComponents;
+}
+
+void FAkComponentManager::ComputeClosestListenerDistancesSquared( const float * in_pX, const float * in_pY, const float * in_pZ, int32 in_iNumPoints,
+	const FVector * in_pListeners, int32 in_iNumListeners, float * out_pDistancesSquared )
+{
+	int32 PointIdx = 0;
+
+	// Four points per iteration: one register per coordinate, the listener broadcast in the others.
+	for( ; PointIdx + 4 <= in_iNumPoints; PointIdx += 4 )
+	{
+		const VectorRegister X = VectorLoad( in_pX + PointIdx );
+		const VectorRegister Y = VectorLoad( in_pY + PointIdx );
+		const VectorRegister Z = VectorLoad( in_pZ + PointIdx );
+
+		VectorRegister MinDistanceSquared = VectorSetFloat1( MAX_FLT );
+		for( int32 ListenerIdx = 0; ListenerIdx < in_iNumListeners; ListenerIdx++ )
+		{
+			const VectorRegister DX = VectorSubtract( X, VectorLoadFloat1( &in_pListeners[ListenerIdx].X ) );
+			const VectorRegister DY = VectorSubtract( Y, VectorLoadFloat1( &in_pListeners[ListenerIdx].Y ) );
+			const VectorRegister DZ = VectorSubtract( Z, VectorLoadFloat1( &in_pListeners[ListenerIdx].Z ) );
+			const VectorRegister DistanceSquared = VectorMultiplyAdd( DX, DX, VectorMultiplyAdd( DY, DY, VectorMultiply( DZ, DZ ) ) );
+			MinDistanceSquared = VectorMin( MinDistanceSquared, DistanceSquared );
+		}
+
+		VectorStore( MinDistanceSquared, out_pDistancesSquared + PointIdx );
+	}
+
+	for( ; PointIdx < in_iNumPoints; PointIdx++ )
+	{
+		float MinDistanceSquared = MAX_FLT;
+		for( int32 ListenerIdx = 0; ListenerIdx < in_iNumListeners; ListenerIdx++ )
+		{
+			const float DX = in_pX[PointIdx] - in_pListeners[ListenerIdx].X;
+			const float DY = in_pY[PointIdx] - in_pListeners[ListenerIdx].Y;
+			const float DZ = in_pZ[PointIdx] - in_pListeners[ListenerIdx].Z;
+			MinDistanceSquared = FMath::Min( MinDistanceSquared, DX * DX + DY * DY + DZ * DZ );
+		}
+		out_pDistancesSquared[PointIdx] = MinDistanceSquared;
+	}
+}
+
+FAkComponentManager::FWorldComponents * FAkComponentManager::FindWorldComponents( UAkComponent * in_pComponent, int32& out_Slot )
+{
+	out_Slot = in_pComponent->ManagerSlot;
+	if( out_Slot == INDEX_NONE )
+	{
+		return NULL;
+	}
+
+	FWorldComponents * WorldComponents = Worlds.Find( in_pComponent->ManagerWorld );
+	check( WorldComponents && WorldComponents->Components.IsValidIndex( out_Slot ) && WorldComponents->Components[out_Slot] == in_pComponent );
+	return WorldComponents;
+}
+
+void FAkComponentManager::UpdateLODTiers( FWorldComponents& in_World, const TArray<FVector>& in_Listeners )
+{
+	const int32 NumComponents = in_World.Components.Num();
+	uint8 * Tiers = in_World.LODTiers.GetData();
+
+	if( LODTiers.Num() == 0 || in_Listeners.Num() == 0 )
+	{
+		// Nothing to measure the distances from: every component updates at full rate.
+		FMemory::Memzero( Tiers, NumComponents );
+		return;
+	}
+
+	DistancesSquared.SetNumUninitialized( NumComponents, false );
+	ComputeClosestListenerDistancesSquared( in_World.PositionsX.GetData(), in_World.PositionsY.GetData(), in_World.PositionsZ.GetData(), NumComponents,
+		in_Listeners.GetData(), in_Listeners.Num(), DistancesSquared.GetData() );
+
+	const int32 LastTier = LODTiers.Num() - 1;
+	const float * MaxDistancesSquared = LODTierMaxDistancesSquared.GetData();
+	for( int32 Slot = 0; Slot < NumComponents; Slot++ )
+	{
+		int32 Tier = 0;
+		while( Tier < LastTier && DistancesSquared[Slot] > MaxDistancesSquared[Tier] )
+		{
+			Tier++;
+		}
+		Tiers[Slot] = (uint8)Tier;
+	}
+}
+
+uint32 FAkComponentManager::UpdateComponents( FWorldComponents& in_World, float in_fWorldTime, float in_fDeltaTime, const TArray<FVector>& in_Listeners )
+{
+	UpdateLODTiers( in_World, in_Listeners );
+
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	const int32 MaxAuxBus = AkAudioDevice ? AkAudioDevice->GetMaxAuxBus() : 0;
+
+	uint32 NumUpdated = 0;
+	const int32 NumComponents = in_World.Components.Num();
+	const uint8 * Flags = in_World.Flags.GetData();
+	const float * NextOcclusionTimes = in_World.NextOcclusionTimes.GetData();
+
+	// Most components have nothing to do: only their flags and occlusion time are read.
+	NumWorkItems = 0;
+	for( int32 Slot = 0; Slot < NumComponents; Slot++ )
+	{
+		if( Flags[Slot] != 0 || in_fWorldTime >= NextOcclusionTimes[Slot] )
+		{
+			if( PrepareComponent( in_World, Slot, in_fWorldTime, MaxAuxBus ) )
+			{
+				NumUpdated++;
+			}
+			else
+			{
+				Stats.NumDeferred++;
+			}
+		}
+	}
+
+	// The fades write to their own component only: batches of work items are computed in parallel.
+	const int32 NumBatches = ( NumWorkItems + PARALLEL_BATCH_SIZE - 1 ) / PARALLEL_BATCH_SIZE;
+	const bool bSingleThread = !bParallelUpdate || NumBatches < 2;
+	FWorkItem * Items = WorkItems.GetData();
+	const int32 NumItems = NumWorkItems;
+	ParallelFor( NumBatches, [Items, NumItems, in_fDeltaTime, MaxAuxBus]( int32 BatchIdx )
+	{
+		const int32 EndIdx = FMath::Min( ( BatchIdx + 1 ) * PARALLEL_BATCH_SIZE, NumItems );
+		for( int32 ItemIdx = BatchIdx * PARALLEL_BATCH_SIZE; ItemIdx < EndIdx; ItemIdx++ )
+		{
+			ComputeWorkItem( Items[ItemIdx], in_fDeltaTime, MaxAuxBus );
+		}
+	}, bSingleThread );
+
+	if( !bSingleThread )
+	{
+		Stats.NumParallelBatches += (uint32)NumBatches;
+	}
+
+	for( int32 ItemIdx = 0; ItemIdx < NumWorkItems; ItemIdx++ )
+	{
+		SubmitWorkItem( in_World, WorkItems[ItemIdx] );
+	}
+
+	Stats.NumVisited += (uint32)NumComponents;
+	Stats.NumUpdated += NumUpdated;
+	return NumUpdated;
+}
+
+bool FAkComponentManager::PrepareComponent( FWorldComponents& in_World, int32 in_Slot, float in_fWorldTime, int32 in_iMaxAuxBus )
+{
+	// Decide from the arrays alone whether the component must be touched.
+	const FLODTier& Tier = GetLODTier( in_World, in_Slot );
+	uint8 Flags = in_World.Flags[in_Slot];
+	const bool bPosition = ( Flags & CF_Position ) && in_fWorldTime >= in_World.LastPositionTimes[in_Slot] + Tier.PositionUpdateInterval;
+	bool bReverbVolumes = ( Flags & CF_ReverbVolumes ) && in_fWorldTime >= in_World.LastReverbTimes[in_Slot] + Tier.ReverbUpdateInterval;
+	bool bOcclusion = ( Flags & CF_OcclusionFade ) || in_fWorldTime >= in_World.NextOcclusionTimes[in_Slot];
+	if( !bPosition && !bReverbVolumes && !bOcclusion )
+	{
+		return false;
+	}
+
+	UAkComponent * Component = in_World.Components[in_Slot];
+
+	if( !Component->IsActive() )
+	{
+		// Inactive components did not tick. Activating a component adds it again, which restores its work.
+		in_World.Flags[in_Slot] = 0;
+		in_World.NextOcclusionTimes[in_Slot] = in_fWorldTime + OCCLUSION_RECHECK_INTERVAL;
+		return true;
+	}
+
+	if( bPosition )
+	{
+		Flags &= ~CF_Position;
+		in_World.LastPositionTimes[in_Slot] = in_fWorldTime;
+		in_World.Flags[in_Slot] = Flags;
+		Component->UpdateGameObjectPosition();
+
+		// The move may have changed the reverb volumes, whose fades then start this update if the LOD tier allows it.
+		Flags = in_World.Flags[in_Slot];
+		bReverbVolumes = ( Flags & CF_ReverbVolumes ) && in_fWorldTime >= in_World.LastReverbTimes[in_Slot] + Tier.ReverbUpdateInterval;
+	}
+
+	// Fades advance by the time elapsed since they were last applied, however long the tier made it.
+	float ReverbDeltaTime = 0.0f;
+	if( bReverbVolumes )
+	{
+		ReverbDeltaTime = in_fWorldTime - in_World.LastReverbTimes[in_Slot];
+		in_World.LastReverbTimes[in_Slot] = in_fWorldTime;
+
+		if( !Component->bUseReverbVolumes || in_iMaxAuxBus <= 0 )
+		{
+			Flags &= ~CF_ReverbVolumes;
+			bReverbVolumes = false;
+		}
+	}
+
+	if( bOcclusion && Component->OcclusionRefreshInterval <= 0.0f )
+	{
+		Flags &= ~CF_OcclusionFade;
+		in_World.NextOcclusionTimes[in_Slot] = in_fWorldTime + OCCLUSION_RECHECK_INTERVAL;
+		bOcclusion = false;
+	}
+
+	if( !bReverbVolumes && !bOcclusion )
+	{
+		FinishComponent( in_World, in_Slot, Flags );
+		return true;
+	}
+
+	in_World.Flags[in_Slot] = Flags;
+
+	if( NumWorkItems == WorkItems.Num() )
+	{
+		WorkItems.AddDefaulted();
+	}
+	FWorkItem& Item = WorkItems[NumWorkItems++];
+	Item.Component = Component;
+	Item.Slot = in_Slot;
+	Item.bReverbVolumes = bReverbVolumes;
+	Item.bOcclusion = bOcclusion;
+	Item.ReverbDeltaTime = ReverbDeltaTime;
+	Item.bReverbFading = false;
+	Item.AuxSends.Reset();
+	Item.FadedListeners = 0;
+	return true;
+}
+
+void FAkComponentManager::ComputeWorkItem( FWorkItem& io_Item, float in_fDeltaTime, int32 in_iMaxAuxBus )
+{
+	UAkComponent * Component = io_Item.Component;
+
+	if( io_Item.bReverbVolumes )
+	{
+		io_Item.bReverbFading = Component->AdvanceAkReverbVolumeFades( io_Item.ReverbDeltaTime );
+		Component->GetAuxSendValues( io_Item.AuxSends, in_iMaxAuxBus );
+	}
+
+	if( io_Item.bOcclusion )
+	{
+		io_Item.FadedListeners = Component->AdvanceOcclusionFades( in_fDeltaTime );
+	}
+}
+
+void FAkComponentManager::SubmitWorkItem( FWorldComponents& in_World, FWorkItem& in_Item )
+{
+	// The submission of an earlier item may have removed a component, moving another one to its slot.
+	UAkComponent * Component = in_Item.Component;
+	const int32 Slot = in_Item.Slot;
+	if( !in_World.Components.IsValidIndex( Slot ) || in_World.Components[Slot] != Component )
+	{
+		return;
+	}
+
+	uint8 Flags = in_World.Flags[Slot];
+
+	if( in_Item.bReverbVolumes )
+	{
+		FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+		if( AkAudioDevice )
+		{
+			AkAudioDevice->SetAuxSends( (AkGameObjectID) Component, in_Item.AuxSends );
+		}
+
+		if( !in_Item.bReverbFading )
+		{
+			Flags &= ~CF_ReverbVolumes;
+		}
+	}
+
+	if( in_Item.bOcclusion )
+	{
+		Component->SendOcclusionValues( in_Item.FadedListeners );
+		Component->RefreshOcclusionIfDue();
+		Flags = Component->IsOcclusionFading() ? ( Flags | CF_OcclusionFade ) : ( Flags & ~CF_OcclusionFade );
+		// Pending traces are consumed on the next update, since their results expire after one frame.
+		in_World.NextOcclusionTimes[Slot] = Component->IsOcclusionTracePending() ? 0.0f
+			: Component->LastOcclusionRefresh + FMath::Max( Component->OcclusionRefreshInterval, GetLODTier( in_World, Slot ).OcclusionRefreshInterval );
+	}
+
+	FinishComponent( in_World, Slot, Flags );
+}
+
+void FAkComponentManager::FinishComponent( FWorldComponents& in_World, int32 in_Slot, uint8 in_uFlags )
+{
+	// Dormant components are skipped by the loop until they wake up, which adds them again.
+	if( in_uFlags == 0 && in_World.Components[in_Slot]->TryEnterDormancy() )
+	{
+		in_World.NextOcclusionTimes[in_Slot] = MAX_FLT;
+	}
+
+	in_World.Flags[in_Slot] = in_uFlags;
+}
+
+/*------------------------------------------------------------------------------------
+	Benchmark
+------------------------------------------------------------------------------------*/
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * Compares the per-component cost of the component ticks with the manager's update loop.
+ * Spawns the given numbers of AkComponents in the world (1000, 10000 and 50000 by default),
+ * updates them a few times each way, and destroys them.
+ *
+ * The tick cost is measured by calling TickComponent directly: the scheduling cost of the
+ * tick functions, which the manager also removes, is not included.
+ */
+static void BenchmarkComponentManager( const TArray<FString>& in_Args, UWorld * in_pWorld )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !AkAudioDevice || !in_pWorld )
+	{
+		return;
+	}
+
+	FAkComponentManager& ComponentManager = AkAudioDevice->GetComponentManager();
+	if( !ComponentManager.IsEnabled() )
+	{
+		UE_LOG(LogAkAudio, Warning, TEXT("AkAudio.BenchmarkComponentManager: enable bCentralizedComponentUpdate in the Wwise settings first."));
+		return;
+	}
+
+	TArray<int32> NumComponentsToTest;
+	for( int32 Idx = 0; Idx < in_Args.Num(); Idx++ )
+	{
+		const int32 NumComponents = FCString::Atoi( *in_Args[Idx] );
+		if( NumComponents > 0 )
+		{
+			NumComponentsToTest.Add( NumComponents );
+		}
+	}
+	if( NumComponentsToTest.Num() == 0 )
+	{
+		NumComponentsToTest.Add( 1000 );
+		NumComponentsToTest.Add( 10000 );
+		NumComponentsToTest.Add( 50000 );
+	}
+
+	const int32 NumIterations = 16;
+	const float DeltaTime = 1.0f / 60.0f;
+	FRandomStream RandomStream( 0x41AC );
+
+	for( int32 TestIdx = 0; TestIdx < NumComponentsToTest.Num(); TestIdx++ )
+	{
+		const int32 NumComponents = NumComponentsToTest[TestIdx];
+
+		TArray<UAkComponent*> Components;
+		Components.Reserve( NumComponents );
+		for( int32 Idx = 0; Idx < NumComponents; Idx++ )
+		{
+			UAkComponent * Component = NewObject<UAkComponent>( in_pWorld->GetWorldSettings() );
+			Component->SetWorldLocation( RandomStream.VRand() * RandomStream.FRandRange( 0.0f, 50000.0f ) );
+			Component->RegisterComponentWithWorld( in_pWorld );
+			Components.Add( Component );
+		}
+
+		// First update: reverb volumes and occlusion are computed for every component.
+		ComponentManager.UpdateWorld( in_pWorld, DeltaTime, AkAudioDevice->GetListenerPositions() );
+
+		double StartTime = FPlatformTime::Seconds();
+		for( int32 Iteration = 0; Iteration < NumIterations; Iteration++ )
+		{
+			for( int32 Idx = 0; Idx < NumComponents; Idx++ )
+			{
+				Components[Idx]->TickComponent( DeltaTime, LEVELTICK_All, NULL );
+			}
+		}
+		const double TickTime = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		for( int32 Iteration = 0; Iteration < NumIterations; Iteration++ )
+		{
+			ComponentManager.UpdateWorld( in_pWorld, DeltaTime, AkAudioDevice->GetListenerPositions() );
+		}
+		const double ManagerTime = FPlatformTime::Seconds() - StartTime;
+
+		const double NanosecondsPerUpdate = 1.0e9 / ( (double)NumIterations * (double)NumComponents );
+		UE_LOG(LogAkAudio, Display, TEXT("AkAudio.BenchmarkComponentManager: %d components: tick %.1f ns, manager %.1f ns per component and frame (%d components in the world)"),
+			NumComponents, TickTime * NanosecondsPerUpdate, ManagerTime * NanosecondsPerUpdate, ComponentManager.GetNumComponents() );
+
+		for( int32 Idx = 0; Idx < NumComponents; Idx++ )
+		{
+			Components[Idx]->DestroyComponent();
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs BenchmarkComponentManagerCommand(
+	TEXT("AkAudio.BenchmarkComponentManager"),
+	TEXT("Measures the per-component update cost of AkComponent ticks and of the component manager. Arguments: numbers of components (default 1000 10000 50000)."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic( &BenchmarkComponentManager )
+	);
+
+/** Scalar version of FAkComponentManager::ComputeClosestListenerDistancesSquared, for comparison */
+static void ComputeClosestListenerDistancesSquaredScalar( const float * in_pX, const float * in_pY, const float * in_pZ, int32 in_iNumPoints,
+	const FVector * in_pListeners, int32 in_iNumListeners, float * out_pDistancesSquared )
+{
+	for( int32 PointIdx = 0; PointIdx < in_iNumPoints; PointIdx++ )
+	{
+		const FVector Point( in_pX[PointIdx], in_pY[PointIdx], in_pZ[PointIdx] );
+		float MinDistanceSquared = MAX_FLT;
+		for( int32 ListenerIdx = 0; ListenerIdx < in_iNumListeners; ListenerIdx++ )
+		{
+			MinDistanceSquared = FMath::Min( MinDistanceSquared, FVector::DistSquared( Point, in_pListeners[ListenerIdx] ) );
+		}
+		out_pDistancesSquared[PointIdx] = MinDistanceSquared;
+	}
+}
+
+/**
+ * Measures the distance kernel used to pick the LOD tiers, against its scalar version, for
+ * 1000, 10000 and 50000 random points (or the given numbers) and 1 to 4 listeners. Does not
+ * need a world nor any AkComponent.
+ */
+static void BenchmarkDistanceKernel( const TArray<FString>& in_Args )
+{
+	TArray<int32> NumPointsToTest;
+	for( int32 Idx = 0; Idx < in_Args.Num(); Idx++ )
+	{
+		const int32 NumPoints = FCString::Atoi( *in_Args[Idx] );
+		if( NumPoints > 0 )
+		{
+			NumPointsToTest.Add( NumPoints );
+		}
+	}
+	if( NumPointsToTest.Num() == 0 )
+	{
+		NumPointsToTest.Add( 1000 );
+		NumPointsToTest.Add( 10000 );
+		NumPointsToTest.Add( 50000 );
+	}
+
+	const int32 NumIterations = 64;
+	FRandomStream RandomStream( 0x41AC );
+
+	TArray<FVector> Listeners;
+	for( int32 ListenerIdx = 0; ListenerIdx < 4; ListenerIdx++ )
+	{
+		Listeners.Add( RandomStream.VRand() * 1000.0f );
+	}
+
+	for( int32 TestIdx = 0; TestIdx < NumPointsToTest.Num(); TestIdx++ )
+	{
+		const int32 NumPoints = NumPointsToTest[TestIdx];
+
+		TArray<float> X, Y, Z, VectorResults, ScalarResults;
+		X.SetNumUninitialized( NumPoints );
+		Y.SetNumUninitialized( NumPoints );
+		Z.SetNumUninitialized( NumPoints );
+		VectorResults.SetNumUninitialized( NumPoints );
+		ScalarResults.SetNumUninitialized( NumPoints );
+		for( int32 Idx = 0; Idx < NumPoints; Idx++ )
+		{
+			const FVector Point = RandomStream.VRand() * RandomStream.FRandRange( 0.0f, 50000.0f );
+			X[Idx] = Point.X;
+			Y[Idx] = Point.Y;
+			Z[Idx] = Point.Z;
+		}
+
+		for( int32 NumListeners = 1; NumListeners <= Listeners.Num(); NumListeners++ )
+		{
+			double StartTime = FPlatformTime::Seconds();
+			for( int32 Iteration = 0; Iteration < NumIterations; Iteration++ )
+			{
+				FAkComponentManager::ComputeClosestListenerDistancesSquared( X.GetData(), Y.GetData(), Z.GetData(), NumPoints, Listeners.GetData(), NumListeners, VectorResults.GetData() );
+			}
+			const double VectorTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			for( int32 Iteration = 0; Iteration < NumIterations; Iteration++ )
+			{
+				ComputeClosestListenerDistancesSquaredScalar( X.GetData(), Y.GetData(), Z.GetData(), NumPoints, Listeners.GetData(), NumListeners, ScalarResults.GetData() );
+			}
+			const double ScalarTime = FPlatformTime::Seconds() - StartTime;
+
+			// Both add the same terms, possibly in a different order.
+			float MaxRelativeError = 0.0f;
+			for( int32 Idx = 0; Idx < NumPoints; Idx++ )
+			{
+				MaxRelativeError = FMath::Max( MaxRelativeError, FMath::Abs( VectorResults[Idx] - ScalarResults[Idx] ) / FMath::Max( ScalarResults[Idx], 1.0f ) );
+			}
+
+			const double NanosecondsPerPoint = 1.0e9 / ( (double)NumIterations * (double)NumPoints );
+			UE_LOG(LogAkAudio, Display, TEXT("AkAudio.BenchmarkDistanceKernel: %d points, %d listeners: vector %.2f ns, scalar %.2f ns per point (max relative difference %g)"),
+				NumPoints, NumListeners, VectorTime * NanosecondsPerPoint, ScalarTime * NanosecondsPerPoint, MaxRelativeError );
+		}
+	}
+}
+
+static FAutoConsoleCommandWithArgs BenchmarkDistanceKernelCommand(
+	TEXT("AkAudio.BenchmarkDistanceKernel"),
+	TEXT("Measures the per-point cost of the listener distance kernel used by the distance LOD tiers. Arguments: numbers of points (default 1000 10000 50000)."),
+	FConsoleCommandWithArgsDelegate::CreateStatic( &BenchmarkDistanceKernel )
+	);
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,128 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkComponentPool.cpp: Per-world pool of spawned AkComponents.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "AkComponentPool.h"
+
+/*------------------------------------------------------------------------------------
+	FAkComponentPool
+------------------------------------------------------------------------------------*/
+
+FAkComponentPool::FAkComponentPool()
+	: PoolSize(0)
+{
+	FMemory::Memzero( Stats );
+}
+
+void FAkComponentPool::Init( int32 in_iPoolSize )
+{
+	PoolSize = FMath::Max( in_iPoolSize, 0 );
+	if( PoolSize > 0 )
+	{
+		FWorldDelegates::OnPostWorldInitialization.AddRaw( this, &FAkComponentPool::OnPostWorldInitialization );
+		FWorldDelegates::OnWorldCleanup.AddRaw( this, &FAkComponentPool::OnWorldCleanup );
+	}
+}
+
+void FAkComponentPool::Term()
+{
+	FWorldDelegates::OnPostWorldInitialization.RemoveAll( this );
+	FWorldDelegates::OnWorldCleanup.RemoveAll( this );
+	Pools.Empty();
+	PoolSize = 0;
+}
+
+UAkComponent * FAkComponentPool::Acquire( UWorld * in_pWorld, const FVector& in_Location, const FRotator& in_Orientation )
+{
+	TArray< TWeakObjectPtr<UAkComponent> > * Pool = Pools.Find( in_pWorld );
+	while( Pool && Pool->Num() > 0 )
+	{
+		UAkComponent * Component = Pool->Pop( false ).Get();
+		if( Component && Component->IsRegistered() && !Component->IsPendingKill() )
+		{
+			Stats.NumHits++;
+			Component->SetWorldLocationAndRotation( in_Location, in_Orientation.Quaternion() );
+			Component->Activate( true );
+			return Component;
+		}
+	}
+
+	Stats.NumMisses++;
+	return CreateComponent( in_pWorld, true, in_Location, in_Orientation );
+}
+
+bool FAkComponentPool::Release( UAkComponent * in_pComponent )
+{
+	if( !in_pComponent->bPooled || !in_pComponent->IsRegistered() )
+	{
+		return false;
+	}
+
+	TArray< TWeakObjectPtr<UAkComponent> > * Pool = Pools.Find( in_pComponent->GetWorld() );
+	if( Pool == NULL || Pool->Num() >= PoolSize )
+	{
+		Stats.NumDiscarded++;
+		return false;
+	}
+
+	in_pComponent->ResetForPool();
+	Pool->Add( in_pComponent );
+	Stats.NumReturned++;
+	return true;
+}
+
+int32 FAkComponentPool::GetNumPooled( UWorld * in_pWorld ) const
+{
+	const TArray< TWeakObjectPtr<UAkComponent> > * Pool = Pools.Find( in_pWorld );
+	return Pool ? Pool->Num() : 0;
+}
+
+UAkComponent * FAkComponentPool::CreateComponent( UWorld * in_pWorld, bool in_bActivate, const FVector& in_Location, const FRotator& in_Orientation )
+{
+	// Same outer as the components spawned without a pool: the world settings keep them alive.
+	AWorldSettings * WorldSettings = in_pWorld->GetWorldSettings();
+	if( WorldSettings == NULL )
+	{
+		return NULL;
+	}
+
+	UAkComponent * Component = NewObject<UAkComponent>( WorldSettings );
+	Component->bPooled = true;
+	Component->bAutoActivate = in_bActivate;
+	Component->SetWorldLocationAndRotation( in_Location, in_Orientation.Quaternion() );
+	Component->RegisterComponentWithWorld( in_pWorld );
+	if( !in_bActivate )
+	{
+		Component->SetComponentTickEnabled( false );
+	}
+	return Component;
+}
+
+void FAkComponentPool::OnPostWorldInitialization( UWorld * in_pWorld, const UWorld::InitializationValues in_IVS )
+{
+	if( !in_pWorld || !in_pWorld->IsGameWorld() )
+	{
+		return;
+	}
+
+	TArray< TWeakObjectPtr<UAkComponent> >& Pool = Pools.FindOrAdd( in_pWorld );
+	Pool.Reserve( PoolSize );
+	while( Pool.Num() < PoolSize )
+	{
+		UAkComponent * Component = CreateComponent( in_pWorld, false, FVector::ZeroVector, FRotator::ZeroRotator );
+		if( Component == NULL )
+		{
+			break;
+		}
+		Pool.Add( Component );
+	}
+}
+
+void FAkComponentPool::OnWorldCleanup( UWorld * in_pWorld, bool in_bSessionEnded, bool in_bCleanupResources )
+{
+	Pools.Remove( in_pWorld );
+}
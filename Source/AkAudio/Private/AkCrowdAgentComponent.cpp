@@ -0,0 +1,99 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkCrowdAgentComponent.cpp:
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+
+/*------------------------------------------------------------------------------------
+	UAkCrowdAgentComponent
+------------------------------------------------------------------------------------*/
+
+UAkCrowdAgentComponent::UAkCrowdAgentComponent(const class FObjectInitializer& ObjectInitializer) :
+Super(ObjectInitializer)
+{
+	// Property initialization
+	CrowdEvent = NULL;
+	Intensity = 1.0f;
+	IndividualEmitter = NULL;
+
+	bIndividual = false;
+	AggregatorSlot = INDEX_NONE;
+}
+
+void UAkCrowdAgentComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( AkAudioDevice && GetWorld() && GetWorld()->AllowAudioPlayback() )
+	{
+		AkAudioDevice->GetCrowdAggregator().Add( this );
+	}
+}
+
+void UAkCrowdAgentComponent::OnUnregister()
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( AkAudioDevice )
+	{
+		AkAudioDevice->GetCrowdAggregator().Remove( this );
+	}
+	bIndividual = false;
+
+	// Lets the events playing on the individual emitter end, unless it goes away with the owner.
+	if( IndividualEmitter && !ReleaseIndividualEmitterIfIdle() )
+	{
+		IndividualEmitter->SetAutoDestroy( true );
+		IndividualEmitter = NULL;
+	}
+
+	Super::OnUnregister();
+}
+
+bool UAkCrowdAgentComponent::PostAgentEvent( UAkAudioEvent * AkEvent )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( AkEvent == NULL || AkAudioDevice == NULL )
+	{
+		return false;
+	}
+
+	if( !bIndividual )
+	{
+		AkAudioDevice->GetCrowdAggregator().OnAgentEvent( false );
+		return false;
+	}
+
+	if( IndividualEmitter == NULL )
+	{
+		AActor * Owner = GetOwner();
+		IndividualEmitter = Owner ? NewObject<UAkComponent>(Owner) : NewObject<UAkComponent>();
+		IndividualEmitter->RegisterComponentWithWorld( GetWorld() );
+		IndividualEmitter->AttachTo( this, NAME_None, EAttachLocation::SnapToTarget );
+	}
+
+	if( IndividualEmitter->IsOutOfAudibleRange( AkEvent ) || !IndividualEmitter->PassesConcurrencyRules( AkEvent ) )
+	{
+		return false;
+	}
+
+	// The end of event tells when the emitter can be released.
+	const bool bPosted = IndividualEmitter->PostAkEventByIDWithHandle( AkEvent->GetEventId(), AK_EndOfEvent ).PlayingID != AK_INVALID_PLAYING_ID;
+	AkAudioDevice->GetCrowdAggregator().OnAgentEvent( bPosted );
+	return bPosted;
+}
+
+bool UAkCrowdAgentComponent::ReleaseIndividualEmitterIfIdle()
+{
+	if( IndividualEmitter == NULL || IndividualEmitter->NumActiveEvents > 0 )
+	{
+		return false;
+	}
+
+	IndividualEmitter->DestroyComponent();
+	IndividualEmitter = NULL;
+	return true;
+}
@@ -0,0 +1,341 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkCrowdAggregator.cpp: Grid of aggregate emitters for crowds of agents.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "AkCrowdAggregator.h"
+
+/*------------------------------------------------------------------------------------
+	FAkCrowdAggregator
+------------------------------------------------------------------------------------*/
+
+/** Time a cell waits after its crowd event failed to post before trying again, in seconds */
+static const float CROWD_POST_RETRY_INTERVAL = 1.0f;
+
+FAkCrowdAggregator::FAkCrowdAggregator()
+	: InvCellSize(0.0f)
+	, MaxIndividualAgents(0)
+	, DensityRtpcID(AK_INVALID_RTPC_ID)
+	, IntensityRtpcID(AK_INVALID_RTPC_ID)
+	, ReleaseDelay(0.0f)
+{
+	FMemory::Memzero( Stats );
+}
+
+void FAkCrowdAggregator::Init( float in_fCellSize, uint32 in_uMaxIndividualAgents, AkRtpcID in_DensityRtpcID, AkRtpcID in_IntensityRtpcID, float in_fReleaseDelay )
+{
+	InvCellSize = in_fCellSize > 0.0f ? 1.0f / in_fCellSize : 0.0f;
+	MaxIndividualAgents = in_uMaxIndividualAgents;
+	DensityRtpcID = in_DensityRtpcID;
+	IntensityRtpcID = in_IntensityRtpcID;
+	ReleaseDelay = FMath::Max( in_fReleaseDelay, 0.0f );
+}
+
+void FAkCrowdAggregator::Term()
+{
+	// The cell emitters are left to the sound engine, which is going away.
+	Cells.Empty();
+	StoppingEmitters.Empty();
+
+	for( int32 Idx = 0; Idx < Agents.Num(); Idx++ )
+	{
+		Agents[Idx]->AggregatorSlot = INDEX_NONE;
+		Agents[Idx]->bIndividual = false;
+	}
+	Agents.Empty();
+	AgentLocations.Empty();
+	NearAgents.Empty();
+}
+
+void FAkCrowdAggregator::Add( UAkCrowdAgentComponent * in_pAgent )
+{
+	if( in_pAgent->AggregatorSlot == INDEX_NONE )
+	{
+		in_pAgent->AggregatorSlot = Agents.Add( in_pAgent );
+	}
+}
+
+void FAkCrowdAggregator::Remove( UAkCrowdAgentComponent * in_pAgent )
+{
+	const int32 Slot = in_pAgent->AggregatorSlot;
+	if( Agents.IsValidIndex( Slot ) && Agents[Slot] == in_pAgent )
+	{
+		RemoveAt( Slot );
+	}
+	in_pAgent->AggregatorSlot = INDEX_NONE;
+}
+
+void FAkCrowdAggregator::RemoveAt( int32 in_Index )
+{
+	Agents.RemoveAtSwap( in_Index, 1, false );
+	if( in_Index < Agents.Num() )
+	{
+		Agents[in_Index]->AggregatorSlot = in_Index;
+	}
+}
+
+void FAkCrowdAggregator::SelectIndividualAgents( const TArray<FVector>& in_Listeners )
+{
+	NearAgents.Reset();
+	if( MaxIndividualAgents == 0 || in_Listeners.Num() == 0 )
+	{
+		return;
+	}
+
+	// Keeps the nearest agents seen so far, replacing the farthest one when a nearer agent comes.
+	int32 FarthestIdx = INDEX_NONE;
+	for( int32 AgentIdx = 0; AgentIdx < AgentLocations.Num(); AgentIdx++ )
+	{
+		float MinDistanceSquared = MAX_FLT;
+		for( int32 ListenerIdx = 0; ListenerIdx < in_Listeners.Num(); ListenerIdx++ )
+		{
+			MinDistanceSquared = FMath::Min( MinDistanceSquared, FVector::DistSquared( AgentLocations[AgentIdx], in_Listeners[ListenerIdx] ) );
+		}
+
+		FNearAgent NearAgent;
+		NearAgent.DistanceSquared = MinDistanceSquared;
+		NearAgent.Index = AgentIdx;
+
+		if( (uint32)NearAgents.Num() < MaxIndividualAgents )
+		{
+			NearAgents.Add( NearAgent );
+			if( FarthestIdx == INDEX_NONE || MinDistanceSquared > NearAgents[FarthestIdx].DistanceSquared )
+			{
+				FarthestIdx = NearAgents.Num() - 1;
+			}
+			continue;
+		}
+
+		if( MinDistanceSquared < NearAgents[FarthestIdx].DistanceSquared )
+		{
+			NearAgents[FarthestIdx] = NearAgent;
+			for( int32 Idx = 0; Idx < NearAgents.Num(); Idx++ )
+			{
+				if( NearAgents[Idx].DistanceSquared > NearAgents[FarthestIdx].DistanceSquared )
+				{
+					FarthestIdx = Idx;
+				}
+			}
+		}
+	}
+
+	for( int32 Idx = 0; Idx < NearAgents.Num(); Idx++ )
+	{
+		Agents[NearAgents[Idx].Index]->bIndividual = true;
+	}
+}
+
+uint32 FAkCrowdAggregator::Update( FAkAudioDevice& in_AudioDevice, float in_fDeltaTime, const TArray<FVector>& in_Listeners )
+{
+	ReturnStoppedEmitters();
+
+	if( Agents.Num() == 0 && Cells.Num() == 0 )
+	{
+		return 0;
+	}
+
+	AgentLocations.Reset();
+	for( int32 AgentIdx = 0; AgentIdx < Agents.Num(); AgentIdx++ )
+	{
+		Agents[AgentIdx]->bIndividual = false;
+		AgentLocations.Add( Agents[AgentIdx]->GetComponentLocation() );
+	}
+
+	SelectIndividualAgents( in_Listeners );
+
+	for( TMap<FCellKey, FCell>::TIterator It(Cells); It; ++It )
+	{
+		FCell& Cell = It.Value();
+		Cell.NumAgents = 0;
+		Cell.TotalIntensity = 0.0f;
+		Cell.PositionSum = FVector::ZeroVector;
+		Cell.WeightedPositionSum = FVector::ZeroVector;
+	}
+
+	for( int32 AgentIdx = 0; AgentIdx < Agents.Num(); AgentIdx++ )
+	{
+		UAkCrowdAgentComponent * Agent = Agents[AgentIdx];
+		if( Agent->bIndividual )
+		{
+			continue;
+		}
+
+		// Agents that left the nearest let their last events end.
+		if( Agent->IndividualEmitter )
+		{
+			Agent->ReleaseIndividualEmitterIfIdle();
+		}
+
+		UWorld * World = Agent->GetWorld();
+		if( Agent->CrowdEvent == NULL || World == NULL )
+		{
+			continue;
+		}
+
+		// With no cell size, all the agents of an event in a world land in the same cell.
+		const FVector& Location = AgentLocations[AgentIdx];
+		FCellKey Key;
+		Key.Event = Agent->CrowdEvent;
+		Key.World = World;
+		Key.X = FMath::FloorToInt( Location.X * InvCellSize );
+		Key.Y = FMath::FloorToInt( Location.Y * InvCellSize );
+		Key.Z = FMath::FloorToInt( Location.Z * InvCellSize );
+
+		FCell* Cell = Cells.Find( Key );
+		if( Cell == NULL )
+		{
+			Cell = &Cells.Add( Key );
+			Cell->Event = Agent->CrowdEvent;
+			Cell->World = World;
+			Cell->NumAgents = 0;
+			Cell->TotalIntensity = 0.0f;
+			Cell->PositionSum = FVector::ZeroVector;
+			Cell->WeightedPositionSum = FVector::ZeroVector;
+			Cell->EmptyTime = 0.0f;
+			Cell->PostRetryDelay = 0.0f;
+		}
+
+		const float AgentIntensity = FMath::Max( Agent->Intensity, 0.0f );
+		Cell->NumAgents++;
+		Cell->TotalIntensity += AgentIntensity;
+		Cell->PositionSum += Location;
+		Cell->WeightedPositionSum += Location * AgentIntensity;
+	}
+
+	for( TMap<FCellKey, FCell>::TIterator It(Cells); It; ++It )
+	{
+		if( !UpdateCell( It.Value(), in_AudioDevice, in_fDeltaTime ) )
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	return (uint32)Cells.Num();
+}
+
+bool FAkCrowdAggregator::UpdateCell( FCell& in_Cell, FAkAudioDevice& in_AudioDevice, float in_fDeltaTime )
+{
+	UAkComponent * Emitter = in_Cell.Emitter.Get();
+
+	if( in_Cell.NumAgents == 0 )
+	{
+		// Silenced through the density RTPC right away, stopped once the delay is over.
+		if( in_Cell.EmptyTime == 0.0f && Emitter && DensityRtpcID != AK_INVALID_RTPC_ID )
+		{
+			Emitter->SetRTPCValueByID( DensityRtpcID, 0.0f, 0 );
+		}
+
+		in_Cell.EmptyTime += in_fDeltaTime;
+		if( Emitter && in_Cell.EmptyTime < ReleaseDelay )
+		{
+			return true;
+		}
+
+		ReleaseEmitter( in_Cell );
+		return false;
+	}
+
+	in_Cell.EmptyTime = 0.0f;
+
+	const FVector Centroid = in_Cell.TotalIntensity > 0.0f ? in_Cell.WeightedPositionSum / in_Cell.TotalIntensity : in_Cell.PositionSum / (float)in_Cell.NumAgents;
+
+	UAkAudioEvent * Event = in_Cell.Event.Get();
+	if( Event == NULL )
+	{
+		ReleaseEmitter( in_Cell );
+		return false;
+	}
+
+	if( Emitter )
+	{
+		Emitter->SetWorldLocation( Centroid );
+	}
+	else
+	{
+		UWorld * World = in_Cell.World.Get();
+		if( World == NULL )
+		{
+			return false;
+		}
+
+		if( in_Cell.PostRetryDelay > 0.0f )
+		{
+			in_Cell.PostRetryDelay -= in_fDeltaTime;
+			return true;
+		}
+
+		// Owned by the cell until released, and by the aggregator until its event ends after that.
+		Emitter = in_AudioDevice.SpawnAkComponentAtLocation( Event, Centroid, FRotator::ZeroRotator, false, FString(), false, World );
+		if( Emitter == NULL )
+		{
+			return false;
+		}
+		in_Cell.Emitter = Emitter;
+	}
+
+	// Set before the first post, so that the event starts with the values of the cell.
+	if( DensityRtpcID != AK_INVALID_RTPC_ID )
+	{
+		Emitter->SetRTPCValueByID( DensityRtpcID, (float)in_Cell.NumAgents, 0 );
+	}
+	if( IntensityRtpcID != AK_INVALID_RTPC_ID )
+	{
+		Emitter->SetRTPCValueByID( IntensityRtpcID, in_Cell.TotalIntensity, 0 );
+	}
+
+	// Posted with an end of event notification, so that NumActiveEvents tells when to post it again.
+	if( Emitter->NumActiveEvents == 0 )
+	{
+		if( Emitter->PostAkEventByIDWithHandle( Event->GetEventId(), AK_EndOfEvent ).PlayingID == AK_INVALID_PLAYING_ID )
+		{
+			in_Cell.PostRetryDelay = CROWD_POST_RETRY_INTERVAL;
+			in_Cell.Emitter = NULL;
+			Emitter->DestroyOrReturnToPool();
+			return true;
+		}
+		Stats.NumCellsStarted++;
+	}
+
+	return true;
+}
+
+void FAkCrowdAggregator::ReleaseEmitter( FCell& in_Cell )
+{
+	UAkComponent * Emitter = in_Cell.Emitter.Get();
+	if( Emitter )
+	{
+		Emitter->Stop();
+		Stats.NumCellsReleased++;
+
+		if( Emitter->NumActiveEvents == 0 )
+		{
+			Emitter->DestroyOrReturnToPool();
+		}
+		else
+		{
+			StoppingEmitters.Add( Emitter );
+		}
+	}
+	in_Cell.Emitter = NULL;
+}
+
+void FAkCrowdAggregator::ReturnStoppedEmitters()
+{
+	for( int32 Idx = StoppingEmitters.Num() - 1; Idx >= 0; Idx-- )
+	{
+		UAkComponent * Emitter = StoppingEmitters[Idx].Get();
+		if( Emitter && Emitter->NumActiveEvents > 0 )
+		{
+			continue;
+		}
+
+		if( Emitter )
+		{
+			Emitter->DestroyOrReturnToPool();
+		}
+		StoppingEmitters.RemoveAtSwap( Idx, 1, false );
+	}
+}
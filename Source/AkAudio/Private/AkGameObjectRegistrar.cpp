@@ -0,0 +1,120 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkGameObjectRegistrar.cpp: Lazy registration of AkComponent game objects.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "AkGameObjectRegistrar.h"
+
+/*------------------------------------------------------------------------------------
+	FAkGameObjectRegistrar
+------------------------------------------------------------------------------------*/
+
+FAkGameObjectRegistrar::FAkGameObjectRegistrar()
+	: IdleTimeout(0.0)
+	, bEnabled(false)
+{
+	FMemory::Memzero( Stats );
+}
+
+void FAkGameObjectRegistrar::Init( float in_fIdleTimeout )
+{
+	IdleTimeout = FMath::Max( in_fIdleTimeout, 0.0f );
+	bEnabled = true;
+}
+
+void FAkGameObjectRegistrar::Term()
+{
+	IdleQueues.Empty();
+	ExpiredEntries.Empty();
+	bEnabled = false;
+}
+
+void FAkGameObjectRegistrar::OnRegisteredLazily( UAkComponent * in_pComponent )
+{
+	Stats.NumRegistered++;
+	MarkIdle( in_pComponent );
+}
+
+TArray<FAkGameObjectRegistrar::FIdleEntry>& FAkGameObjectRegistrar::GetIdleQueue( UWorld * in_pWorld )
+{
+	for( int32 Idx = 0; Idx < IdleQueues.Num(); Idx++ )
+	{
+		if( IdleQueues[Idx].World.Get() == in_pWorld )
+		{
+			return IdleQueues[Idx].Entries;
+		}
+	}
+
+	FWorldIdleQueue& Queue = IdleQueues[IdleQueues.AddDefaulted()];
+	Queue.World = in_pWorld;
+	return Queue.Entries;
+}
+
+void FAkGameObjectRegistrar::MarkIdle( UAkComponent * in_pComponent )
+{
+	UWorld * World = in_pComponent->GetWorld();
+	if( !bEnabled || in_pComponent->bKeepGameObjectRegistered || World == NULL )
+	{
+		return;
+	}
+
+	// The previous entry of the component, if any, becomes stale.
+	in_pComponent->IdleExpiryTime = World->GetTimeSeconds() + IdleTimeout;
+	GetIdleQueue( World ).Add( FIdleEntry( in_pComponent, in_pComponent->IdleExpiryTime ) );
+}
+
+uint32 FAkGameObjectRegistrar::Update()
+{
+	// Taken out of every queue first, as the components still playing are marked idle again.
+	ExpiredEntries.Reset();
+	for( int32 QueueIdx = IdleQueues.Num() - 1; QueueIdx >= 0; QueueIdx-- )
+	{
+		UWorld * World = IdleQueues[QueueIdx].World.Get();
+		if( World == NULL )
+		{
+			// The components went away with their world.
+			IdleQueues.RemoveAtSwap( QueueIdx );
+			continue;
+		}
+
+		TArray<FIdleEntry>& Entries = IdleQueues[QueueIdx].Entries;
+		const double Now = World->GetTimeSeconds();
+		int32 NumExpired = 0;
+		while( NumExpired < Entries.Num() && Entries[NumExpired].ExpiryTime <= Now )
+		{
+			NumExpired++;
+		}
+
+		if( NumExpired > 0 )
+		{
+			ExpiredEntries.Append( Entries.GetData(), NumExpired );
+			Entries.RemoveAt( 0, NumExpired, false );
+		}
+	}
+
+	uint32 NumUnregistered = 0;
+	for( int32 Idx = 0; Idx < ExpiredEntries.Num(); Idx++ )
+	{
+		UAkComponent * Component = ExpiredEntries[Idx].Component.Get();
+		if( Component == NULL || Component->IdleExpiryTime != ExpiredEntries[Idx].ExpiryTime )
+		{
+			continue;
+		}
+
+		if( Component->TryUnregisterIdleGameObject() )
+		{
+			NumUnregistered++;
+		}
+		else if( Component->IsGameObjectRegistered() )
+		{
+			// An event is still playing: check again once it could have been idle for the timeout.
+			MarkIdle( Component );
+		}
+	}
+
+	Stats.NumUnregistered += NumUnregistered;
+	return NumUnregistered;
+}
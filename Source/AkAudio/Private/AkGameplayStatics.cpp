@@ -142,6 +142,22 @@ void UAkGameplayStatics::PostEventAtLocationByName( const FString& EventName, FV
 	}
 }
 
+void UAkGameplayStatics::PostImpactAtLocation( class UAkAudioEvent* in_pAkEvent, FVector Location, float Intensity, UObject* WorldContextObject )
+{
+	if ( in_pAkEvent == NULL )
+	{
+		UE_LOG(LogScript, Warning, TEXT("UAkGameplayStatics::PostImpactAtLocation: No Event specified!"));
+		return;
+	}
+
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	UWorld* CurrentWorld = GEngine->GetWorldFromContextObject(WorldContextObject);
+	if( CurrentWorld && CurrentWorld->AllowAudioPlayback() && AkAudioDevice )
+	{
+		AkAudioDevice->GetImpactAggregator().AddImpact(in_pAkEvent, Location, Intensity, CurrentWorld);
+	}
+}
+
 UAkComponent* UAkGameplayStatics::SpawnAkComponentAtLocation(UObject* WorldContextObject, class UAkAudioEvent* AkEvent, FVector Location, FRotator Orientation, bool AutoPost, const FString& EventName, bool AutoDestroy /* = true*/ )
 {
 	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
@@ -159,7 +175,7 @@ void UAkGameplayStatics::SetRTPCValue( FName RTPC, float Value, int32 Interpolat
 	FAkAudioDevice * AudioDevice = FAkAudioDevice::Get();
 	if( AudioDevice && RTPC.IsValid() )
 	{
-		AudioDevice->SetRTPCValue( *RTPC.ToString(), Value, InterpolationTimeMs, Actor );
+		AudioDevice->SetRTPCValue( FAkAudioDevice::GetIDFromName(RTPC), Value, InterpolationTimeMs, Actor );
 	}
 }
 
@@ -168,7 +184,7 @@ void UAkGameplayStatics::SetState( FName stateGroup, FName state )
 	FAkAudioDevice * AudioDevice = FAkAudioDevice::Get();
 	if( AudioDevice && stateGroup.IsValid() && state.IsValid() )
 	{
-		AudioDevice->SetState( *stateGroup.ToString() , *state.ToString() );
+		AudioDevice->SetState( FAkAudioDevice::GetIDFromName(stateGroup), FAkAudioDevice::GetIDFromName(state) );
 	}
 }
 
@@ -183,7 +199,7 @@ void UAkGameplayStatics::PostTrigger( FName Trigger, class AActor* Actor )
 	FAkAudioDevice * AudioDevice = FAkAudioDevice::Get();
 	if( AudioDevice && Trigger.IsValid() )
 	{
-		AudioDevice->PostTrigger( *Trigger.ToString(), Actor );
+		AudioDevice->PostTrigger( FAkAudioDevice::GetIDFromName(Trigger), Actor );
 	}
 }
 
@@ -198,7 +214,7 @@ void UAkGameplayStatics::SetSwitch( FName SwitchGroup, FName SwitchState, class
 	FAkAudioDevice * AudioDevice = FAkAudioDevice::Get();
 	if( AudioDevice && SwitchGroup.IsValid() && SwitchState.IsValid() )
 	{
-		AudioDevice->SetSwitch( *SwitchGroup.ToString(), *SwitchState.ToString(), Actor );
+		AudioDevice->SetSwitch( FAkAudioDevice::GetIDFromName(SwitchGroup), FAkAudioDevice::GetIDFromName(SwitchState), Actor );
 	}
 }
 
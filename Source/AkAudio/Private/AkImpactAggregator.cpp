@@ -0,0 +1,116 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkImpactAggregator.cpp: Per-frame merging of physics impact sounds.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "AkImpactAggregator.h"
+
+/*------------------------------------------------------------------------------------
+	FAkImpactAggregator
+------------------------------------------------------------------------------------*/
+
+FAkImpactAggregator::FAkImpactAggregator()
+	: InvBucketSize(0.0f)
+	, MaxImpactsPerBucket(1)
+	, IntensityRtpcID(AK_INVALID_RTPC_ID)
+{
+	FMemory::Memzero( Stats );
+}
+
+void FAkImpactAggregator::Init( float in_fBucketSize, uint32 in_uMaxImpactsPerBucket, AkRtpcID in_IntensityRtpcID )
+{
+	InvBucketSize = in_fBucketSize > 0.0f ? 1.0f / in_fBucketSize : 0.0f;
+	MaxImpactsPerBucket = FMath::Max<uint32>( in_uMaxImpactsPerBucket, 1 );
+	IntensityRtpcID = in_IntensityRtpcID;
+}
+
+void FAkImpactAggregator::Term()
+{
+	Buckets.Empty();
+}
+
+void FAkImpactAggregator::AddImpact( UAkAudioEvent * in_pEvent, const FVector& in_Location, float in_fIntensity, UWorld * in_pWorld )
+{
+	if( !in_pEvent )
+	{
+		return;
+	}
+
+	Stats.NumImpacts++;
+
+	// With no bucket size, every impact of an event in a world lands in the same bucket.
+	FBucketKey Key;
+	Key.Event = in_pEvent;
+	Key.World = in_pWorld;
+	Key.X = FMath::FloorToInt( in_Location.X * InvBucketSize );
+	Key.Y = FMath::FloorToInt( in_Location.Y * InvBucketSize );
+	Key.Z = FMath::FloorToInt( in_Location.Z * InvBucketSize );
+
+	FBucket* Bucket = Buckets.Find( Key );
+	if( Bucket == NULL )
+	{
+		Bucket = &Buckets.Add( Key );
+		Bucket->Event = in_pEvent;
+		Bucket->World = in_pWorld;
+	}
+
+	FImpact Impact;
+	Impact.Location = in_Location;
+	Impact.Intensity = in_fIntensity;
+
+	if( (uint32)Bucket->Impacts.Num() < MaxImpactsPerBucket )
+	{
+		Bucket->Impacts.Add( Impact );
+		return;
+	}
+
+	// Full: the new impact replaces the weakest one if it is stronger, and is merged otherwise.
+	int32 WeakestIdx = 0;
+	for( int32 Idx = 1; Idx < Bucket->Impacts.Num(); Idx++ )
+	{
+		if( Bucket->Impacts[Idx].Intensity < Bucket->Impacts[WeakestIdx].Intensity )
+		{
+			WeakestIdx = Idx;
+		}
+	}
+
+	if( in_fIntensity > Bucket->Impacts[WeakestIdx].Intensity )
+	{
+		Bucket->Impacts[WeakestIdx] = Impact;
+	}
+	Stats.NumMerged++;
+}
+
+uint32 FAkImpactAggregator::Flush( FAkAudioDevice& in_AudioDevice )
+{
+	uint32 NumPosted = 0;
+
+	for( TMap<FBucketKey, FBucket>::TConstIterator It(Buckets); It; ++It )
+	{
+		const FBucket& Bucket = It.Value();
+		UAkAudioEvent * Event = Bucket.Event.Get();
+		if( Event == NULL )
+		{
+			continue;
+		}
+
+		UWorld * World = Bucket.World.Get();
+		for( int32 Idx = 0; Idx < Bucket.Impacts.Num(); Idx++ )
+		{
+			const FImpact& Impact = Bucket.Impacts[Idx];
+			if( in_AudioDevice.PostEventAtLocation( Event, Impact.Location, FVector::ForwardVector, World, IntensityRtpcID, Impact.Intensity ) != AK_INVALID_PLAYING_ID )
+			{
+				NumPosted++;
+			}
+		}
+	}
+
+	// Keeps the allocation: the same number of buckets is likely to be needed next frame.
+	Buckets.Reset();
+
+	Stats.NumPosted += NumPosted;
+	return NumPosted;
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkMultiPositionComponent.cpp:
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+
+/*------------------------------------------------------------------------------------
+	UAkMultiPositionComponent
+------------------------------------------------------------------------------------*/
+
+UAkMultiPositionComponent::UAkMultiPositionComponent(const class FObjectInitializer& ObjectInitializer) :
+Super(ObjectInitializer)
+{
+	// Property initialization
+	MultiPositionType = EAkMultiPositionType::MultiSources;
+
+	ReverbQueryPoint = FVector::ZeroVector;
+	bHasReverbQueryPoint = false;
+}
+
+void UAkMultiPositionComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+	// The positions stay put, but the one closest to the listeners changes as they walk along them.
+	if( bIsActive && Positions.Num() > 1 && AK::SoundEngine::IsInitialized() )
+	{
+		UpdateReverbVolumesIfClosestChanged();
+	}
+
+	Super::TickComponent( DeltaTime, TickType, ThisTickFunction );
+}
+
+void UAkMultiPositionComponent::SetPositions( const TArray<FVector>& in_Positions )
+{
+	Positions = in_Positions;
+	UpdateGameObjectPosition();
+}
+
+void UAkMultiPositionComponent::SetMultiPositionType( EAkMultiPositionType::Type in_eType )
+{
+	MultiPositionType = in_eType;
+	UpdateGameObjectPosition();
+}
+
+FVector UAkMultiPositionComponent::GetClosestPosition( const FVector& in_Point ) const
+{
+	if( Positions.Num() == 0 )
+	{
+		return GetComponentLocation();
+	}
+
+	int32 ClosestIdx = 0;
+	float ClosestDistanceSquared = FVector::DistSquared( Positions[0], in_Point );
+	for( int32 Idx = 1; Idx < Positions.Num(); Idx++ )
+	{
+		const float DistanceSquared = FVector::DistSquared( Positions[Idx], in_Point );
+		if( DistanceSquared < ClosestDistanceSquared )
+		{
+			ClosestDistanceSquared = DistanceSquared;
+			ClosestIdx = Idx;
+		}
+	}
+	return Positions[ClosestIdx];
+}
+
+FVector UAkMultiPositionComponent::GetClosestPositionToListeners() const
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !AkAudioDevice || AkAudioDevice->GetListenerPositions().Num() == 0 )
+	{
+		return GetComponentLocation();
+	}
+
+	const TArray<FVector>& ListenerPositions = AkAudioDevice->GetListenerPositions();
+	FVector ClosestPosition = GetClosestPosition( ListenerPositions[0] );
+	float ClosestDistanceSquared = FVector::DistSquared( ClosestPosition, ListenerPositions[0] );
+	for( int32 ListenerIdx = 1; ListenerIdx < ListenerPositions.Num(); ListenerIdx++ )
+	{
+		const FVector Position = GetClosestPosition( ListenerPositions[ListenerIdx] );
+		const float DistanceSquared = FVector::DistSquared( Position, ListenerPositions[ListenerIdx] );
+		if( DistanceSquared < ClosestDistanceSquared )
+		{
+			ClosestDistanceSquared = DistanceSquared;
+			ClosestPosition = Position;
+		}
+	}
+	return ClosestPosition;
+}
+
+bool UAkMultiPositionComponent::IsOutOfAudibleRange( const UAkAudioEvent * in_pEvent ) const
+{
+	// Out of range of every listener from the closest position means out of range from all of them.
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	return AkAudioDevice && AkAudioDevice->IsOutOfAudibleRange( in_pEvent, GetClosestPositionToListeners(), AttenuationScalingFactor );
+}
+
+void UAkMultiPositionComponent::UpdateGameObjectPosition()
+{
+	if( !bIsActive )
+	{
+		return;
+	}
+
+	const AK::SoundEngine::MultiPositionType eType = MultiPositionType == EAkMultiPositionType::MultiDirections
+		? AK::SoundEngine::MultiPositionType_MultiDirections
+		: AK::SoundEngine::MultiPositionType_MultiSources;
+
+	if( Positions.Num() == 0 )
+	{
+		const FVector Location = GetComponentLocation();
+		SetGameObjectPositions( &Location, 1, eType );
+	}
+	else
+	{
+		SetGameObjectPositions( Positions.GetData(), Positions.Num(), eType );
+	}
+
+	bHasReverbQueryPoint = false;
+	UpdateReverbVolumesIfClosestChanged();
+}
+
+void UAkMultiPositionComponent::UpdateReverbVolumesIfClosestChanged()
+{
+	const FVector ReverbPoint = GetClosestPositionToListeners();
+	if( !bHasReverbQueryPoint || ReverbPoint != ReverbQueryPoint )
+	{
+		ReverbQueryPoint = ReverbPoint;
+		bHasReverbQueryPoint = true;
+		UpdateReverbVolumesAtPosition();
+	}
+}
+
+FVector UAkMultiPositionComponent::GetReverbVolumeQueryPosition() const
+{
+	return GetClosestPositionToListeners();
+}
+
+FVector UAkMultiPositionComponent::GetOcclusionSourcePosition( const FVector& in_ListenerPosition ) const
+{
+	return GetClosestPosition( in_ListenerPosition );
+}
+
+#if WITH_EDITOR
+void UAkMultiPositionComponent::PostEditChangeProperty( FPropertyChangedEvent& PropertyChangedEvent )
+{
+	Super::PostEditChangeProperty( PropertyChangedEvent );
+
+	if( IsRegistered() )
+	{
+		UpdateGameObjectPosition();
+	}
+}
+#endif
@@ -0,0 +1,157 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkOneShotEmitterPool.cpp: Recycled game objects for events posted at a location.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkOneShotEmitterPool.h"
+
+/** Number of distinct IDs given to transient game objects before they wrap around */
+#define ONESHOT_TRANSIENT_GAMEOBJ_COUNT 0x8000
+
+/** Upper bound on the pool size, so that the whole ID range stays far below any component address */
+#define ONESHOT_MAX_EMITTERS 0x4000
+
+/*------------------------------------------------------------------------------------
+	FAkOneShotEmitterPool
+------------------------------------------------------------------------------------*/
+
+FAkOneShotEmitterPool::FAkOneShotEmitterPool()
+	: NumEmitters(0)
+	, NextTransientIndex(0)
+{
+}
+
+void FAkOneShotEmitterPool::Init( uint32 in_uNumEmitters )
+{
+	FScopeLock Lock(&FreeEmittersCriticalSection);
+
+	NumEmitters = FMath::Min<uint32>( in_uNumEmitters, ONESHOT_MAX_EMITTERS );
+	NextTransientIndex = 0;
+	FreeEmitters.Empty( NumEmitters );
+	EmitterRtpcs.Init( AK_INVALID_RTPC_ID, NumEmitters );
+
+	// Pushed in reverse so that the lowest IDs are handed out first.
+	for( int32 Idx = (int32)NumEmitters - 1; Idx >= 0; Idx-- )
+	{
+		const AkGameObjectID GameObjID = ONESHOT_GAMEOBJ_BASE + Idx;
+#ifndef AK_OPTIMIZED
+		AK::SoundEngine::RegisterGameObj( GameObjID, TCHAR_TO_ANSI(*FString::Printf(TEXT("OneShot Emitter %d"), Idx)) );
+#else
+		AK::SoundEngine::RegisterGameObj( GameObjID );
+#endif
+		FreeEmitters.Add( (uint32)Idx );
+	}
+
+	NumActiveEmitters.Reset();
+	NumOverflows.Reset();
+}
+
+void FAkOneShotEmitterPool::Term()
+{
+	FScopeLock Lock(&FreeEmittersCriticalSection);
+	for( uint32 Idx = 0; Idx < NumEmitters; Idx++ )
+	{
+		AK::SoundEngine::UnregisterGameObj( ONESHOT_GAMEOBJ_BASE + Idx );
+	}
+
+	NumEmitters = 0;
+	FreeEmitters.Empty();
+	EmitterRtpcs.Empty();
+	NumActiveEmitters.Reset();
+}
+
+AkPlayingID FAkOneShotEmitterPool::PostEvent(
+	FAkPlayingIDRegistry & in_PlayingIDRegistry,
+	AkUniqueID in_EventID,
+	const TCHAR * in_pszEventName,
+	const FVector & in_Location,
+	const AkSoundPosition & in_SoundPosition,
+	TArray<AkAuxSendValue> & in_AuxSendValues,
+	AkRtpcID in_RtpcID,
+	AkRtpcValue in_RtpcValue
+	)
+{
+	AkGameObjectID GameObjID = AK_INVALID_GAME_OBJECT;
+	{
+		FScopeLock Lock(&FreeEmittersCriticalSection);
+		if( FreeEmitters.Num() > 0 )
+		{
+			GameObjID = ONESHOT_GAMEOBJ_BASE + FreeEmitters.Pop( false );
+		}
+	}
+
+	if( GameObjID == AK_INVALID_GAME_OBJECT )
+	{
+		// Every emitter is busy: fall back to a short-lived game object. Its ID is unique
+		// across the last ONESHOT_TRANSIENT_GAMEOBJ_COUNT overflows, so it can't be mistaken
+		// for a game object that is still playing.
+		NumOverflows.Increment();
+		GameObjID = ONESHOT_GAMEOBJ_BASE + NumEmitters + ( NextTransientIndex++ % ONESHOT_TRANSIENT_GAMEOBJ_COUNT );
+
+#ifndef AK_OPTIMIZED
+		AK::SoundEngine::RegisterGameObj( GameObjID, in_pszEventName ? TCHAR_TO_ANSI(in_pszEventName) : "" );
+#else
+		AK::SoundEngine::RegisterGameObj( GameObjID );
+#endif
+		AK::SoundEngine::SetGameObjectAuxSendValues( GameObjID, in_AuxSendValues.GetData(), in_AuxSendValues.Num() );
+		AK::SoundEngine::SetPosition( GameObjID, in_SoundPosition );
+		if( in_RtpcID != AK_INVALID_RTPC_ID )
+		{
+			AK::SoundEngine::SetRTPCValue( in_RtpcID, in_RtpcValue, GameObjID );
+		}
+		AkPlayingID playingID = in_PlayingIDRegistry.PostEvent( in_EventID, GameObjID, 0, NULL, NULL, in_Location ).PlayingID;
+		AK::SoundEngine::UnregisterGameObj( GameObjID );
+		return playingID;
+	}
+
+	AK::SoundEngine::SetGameObjectAuxSendValues( GameObjID, in_AuxSendValues.GetData(), in_AuxSendValues.Num() );
+	AK::SoundEngine::SetPosition( GameObjID, in_SoundPosition );
+
+	// The game object keeps RTPC values across events: don't let the previous user's leak into this one.
+	AkRtpcID& EmitterRtpc = EmitterRtpcs[ (int32)( GameObjID - ONESHOT_GAMEOBJ_BASE ) ];
+	if( EmitterRtpc != AK_INVALID_RTPC_ID && EmitterRtpc != in_RtpcID )
+	{
+		AK::SoundEngine::ResetRTPCValue( EmitterRtpc, GameObjID );
+	}
+	if( in_RtpcID != AK_INVALID_RTPC_ID )
+	{
+		AK::SoundEngine::SetRTPCValue( in_RtpcID, in_RtpcValue, GameObjID );
+	}
+	EmitterRtpc = in_RtpcID;
+
+	NumActiveEmitters.Increment();
+	AkPlayingID playingID = in_PlayingIDRegistry.PostEvent( in_EventID, GameObjID, AK_EndOfEvent, &FAkOneShotEmitterPool::OneShotEmitterCallback, this, in_Location ).PlayingID;
+	if( playingID == AK_INVALID_PLAYING_ID )
+	{
+		// No end of event will ever come for this one.
+		Release( GameObjID );
+	}
+
+	return playingID;
+}
+
+void FAkOneShotEmitterPool::OneShotEmitterCallback( AkCallbackType in_eType, AkCallbackInfo* in_pCallbackInfo )
+{
+	if( in_eType == AK_EndOfEvent )
+	{
+		FAkOneShotEmitterPool* Pool = (FAkOneShotEmitterPool*)in_pCallbackInfo->pCookie;
+		if( Pool )
+		{
+			Pool->Release( in_pCallbackInfo->gameObjID );
+		}
+	}
+}
+
+void FAkOneShotEmitterPool::Release( AkGameObjectID in_GameObjID )
+{
+	FScopeLock Lock(&FreeEmittersCriticalSection);
+
+	const uint32 Idx = (uint32)( in_GameObjID - ONESHOT_GAMEOBJ_BASE );
+	if( in_GameObjID >= ONESHOT_GAMEOBJ_BASE && Idx < NumEmitters )
+	{
+		FreeEmitters.Add( Idx );
+		NumActiveEmitters.Decrement();
+	}
+}
@@ -0,0 +1,332 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkParameterWriteCombiner.cpp: Per-frame coalescing of RTPC, switch and state writes.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkParameterWriteCombiner.h"
+
+/*------------------------------------------------------------------------------------
+	FAkParameterWriteCombiner
+------------------------------------------------------------------------------------*/
+
+FAkParameterWriteCombiner::FAkParameterWriteCombiner()
+	: bStatesDirty(false)
+	, RTPCEpsilon(0.0f)
+	, bEnabled(false)
+{
+	FMemory::Memzero( Stats );
+}
+
+void FAkParameterWriteCombiner::Init( float in_fRTPCEpsilon )
+{
+	FScopeLock Lock(&CombinerCriticalSection);
+	RTPCEpsilon = FMath::Max( in_fRTPCEpsilon, 0.0f );
+	bEnabled = true;
+}
+
+void FAkParameterWriteCombiner::Term()
+{
+	FScopeLock Lock(&CombinerCriticalSection);
+	GameObjects.Empty();
+	States.Empty();
+	DirtyGameObjects.Empty();
+	bStatesDirty = false;
+	bEnabled = false;
+}
+
+void FAkParameterWriteCombiner::SetRTPCValue( AkRtpcID in_RtpcID, AkRtpcValue in_Value, AkGameObjectID in_GameObjID, AkTimeMs in_InterpolationTimeMs )
+{
+	FScopeLock Lock(&CombinerCriticalSection);
+	Stats.NumWrites++;
+
+	FGameObjectValues& GameObject = GameObjects.FindOrAdd( in_GameObjID );
+	FRtpcValue* Value = GameObject.Rtpcs.Find( in_RtpcID );
+	if( Value == NULL )
+	{
+		Value = &GameObject.Rtpcs.Add( in_RtpcID );
+		Value->bSubmitted = false;
+		Value->bPending = false;
+	}
+
+	if( Value->bPending )
+	{
+		Stats.NumCoalesced++;
+	}
+	else if( Value->bSubmitted && FMath::Abs( in_Value - Value->SubmittedValue ) <= RTPCEpsilon )
+	{
+		Stats.NumDropped++;
+		return;
+	}
+
+	Value->PendingValue = in_Value;
+	Value->PendingInterpolationTimeMs = in_InterpolationTimeMs;
+	Value->bPending = true;
+
+	MarkDirty( in_GameObjID, GameObject );
+}
+
+void FAkParameterWriteCombiner::MarkDirty( AkGameObjectID in_GameObjID, FGameObjectValues& io_GameObject )
+{
+	io_GameObject.bDirty = true;
+	if( !io_GameObject.bListed )
+	{
+		io_GameObject.bListed = true;
+		DirtyGameObjects.Add( in_GameObjID );
+	}
+}
+
+bool FAkParameterWriteCombiner::SetGroupValue( FGroupValue& io_Value, AkUniqueID in_NewValue, bool in_bNew )
+{
+	if( in_bNew )
+	{
+		io_Value.bPending = false;
+	}
+
+	// Not compared to the submitted value: Set Switch and Set State actions change it behind the combiner's back.
+	if( io_Value.bPending )
+	{
+		Stats.NumCoalesced++;
+	}
+
+	io_Value.PendingValue = in_NewValue;
+	io_Value.bPending = true;
+	return true;
+}
+
+void FAkParameterWriteCombiner::SetSwitch( AkSwitchGroupID in_SwitchGroupID, AkSwitchStateID in_SwitchStateID, AkGameObjectID in_GameObjID )
+{
+	FScopeLock Lock(&CombinerCriticalSection);
+	Stats.NumWrites++;
+
+	FGameObjectValues& GameObject = GameObjects.FindOrAdd( in_GameObjID );
+	FGroupValue* Value = GameObject.Switches.Find( in_SwitchGroupID );
+	const bool bNew = ( Value == NULL );
+	if( bNew )
+	{
+		Value = &GameObject.Switches.Add( in_SwitchGroupID );
+	}
+
+	if( SetGroupValue( *Value, in_SwitchStateID, bNew ) )
+	{
+		MarkDirty( in_GameObjID, GameObject );
+	}
+}
+
+void FAkParameterWriteCombiner::SetState( AkStateGroupID in_StateGroupID, AkStateID in_StateID )
+{
+	FScopeLock Lock(&CombinerCriticalSection);
+	Stats.NumWrites++;
+
+	FGroupValue* Value = States.Find( in_StateGroupID );
+	const bool bNew = ( Value == NULL );
+	if( bNew )
+	{
+		Value = &States.Add( in_StateGroupID );
+	}
+
+	if( SetGroupValue( *Value, in_StateID, bNew ) )
+	{
+		bStatesDirty = true;
+	}
+}
+
+uint32 FAkParameterWriteCombiner::Flush( FAkAudioCommandQueue& in_CommandQueue )
+{
+	if( !bEnabled )
+	{
+		return 0;
+	}
+
+	FScopeLock Lock(&CombinerCriticalSection);
+
+	uint32 NumSubmitted = SubmitStates( in_CommandQueue );
+	for( int32 Idx = 0; Idx < DirtyGameObjects.Num(); Idx++ )
+	{
+		const AkGameObjectID GameObjID = DirtyGameObjects[Idx];
+		FGameObjectValues* GameObject = GameObjects.Find( GameObjID );
+		if( GameObject == NULL )
+		{
+			// Forgotten since it was written to.
+			continue;
+		}
+
+		GameObject->bListed = false;
+		if( GameObject->bDirty )
+		{
+			NumSubmitted += SubmitGameObject( GameObjID, *GameObject, in_CommandQueue );
+		}
+	}
+	DirtyGameObjects.Reset();
+
+	Stats.NumSubmitted += NumSubmitted;
+	return NumSubmitted;
+}
+
+uint32 FAkParameterWriteCombiner::FlushGameObject( AkGameObjectID in_GameObjID, FAkAudioCommandQueue& in_CommandQueue )
+{
+	if( !bEnabled )
+	{
+		return 0;
+	}
+
+	FScopeLock Lock(&CombinerCriticalSection);
+
+	// Left in DirtyGameObjects, which Flush skips once they are clean.
+	uint32 NumSubmitted = SubmitStates( in_CommandQueue );
+	FGameObjectValues* GameObject = GameObjects.Find( in_GameObjID );
+	if( GameObject && GameObject->bDirty )
+	{
+		NumSubmitted += SubmitGameObject( in_GameObjID, *GameObject, in_CommandQueue );
+	}
+
+	// Global RTPCs apply to every game object.
+	if( in_GameObjID != AK_INVALID_GAME_OBJECT )
+	{
+		FGameObjectValues* Global = GameObjects.Find( AK_INVALID_GAME_OBJECT );
+		if( Global && Global->bDirty )
+		{
+			NumSubmitted += SubmitGameObject( AK_INVALID_GAME_OBJECT, *Global, in_CommandQueue );
+		}
+	}
+
+	Stats.NumSubmitted += NumSubmitted;
+	return NumSubmitted;
+}
+
+uint32 FAkParameterWriteCombiner::SubmitStates( FAkAudioCommandQueue& in_CommandQueue )
+{
+	if( !bStatesDirty )
+	{
+		return 0;
+	}
+
+	const bool bUseCommandQueue = in_CommandQueue.IsEnabled();
+	uint32 NumSubmitted = 0;
+	for( TMap<AkStateGroupID, FGroupValue>::TIterator It(States); It; ++It )
+	{
+		FGroupValue& Value = It.Value();
+		if( !Value.bPending )
+		{
+			continue;
+		}
+
+		Value.bPending = false;
+		if( bUseCommandQueue )
+		{
+			in_CommandQueue.EnqueueSetState( It.Key(), Value.PendingValue );
+		}
+		else
+		{
+			AK::SoundEngine::SetState( It.Key(), Value.PendingValue );
+		}
+		NumSubmitted++;
+	}
+	bStatesDirty = false;
+	return NumSubmitted;
+}
+
+uint32 FAkParameterWriteCombiner::SubmitGameObject( AkGameObjectID in_GameObjID, FGameObjectValues& io_GameObject, FAkAudioCommandQueue& in_CommandQueue )
+{
+	const bool bUseCommandQueue = in_CommandQueue.IsEnabled();
+	uint32 NumSubmitted = 0;
+
+	for( TMap<AkRtpcID, FRtpcValue>::TIterator It(io_GameObject.Rtpcs); It; ++It )
+	{
+		FRtpcValue& Value = It.Value();
+		if( !Value.bPending )
+		{
+			continue;
+		}
+
+		Value.bPending = false;
+		if( Value.bSubmitted && FMath::Abs( Value.PendingValue - Value.SubmittedValue ) <= RTPCEpsilon )
+		{
+			Stats.NumDropped++;
+			continue;
+		}
+
+		if( bUseCommandQueue )
+		{
+			in_CommandQueue.EnqueueSetRTPCValue( It.Key(), Value.PendingValue, in_GameObjID, Value.PendingInterpolationTimeMs );
+		}
+		else
+		{
+			AK::SoundEngine::SetRTPCValue( It.Key(), Value.PendingValue, in_GameObjID, Value.PendingInterpolationTimeMs );
+		}
+		Value.SubmittedValue = Value.PendingValue;
+		Value.bSubmitted = true;
+		NumSubmitted++;
+	}
+
+	for( TMap<AkSwitchGroupID, FGroupValue>::TIterator It(io_GameObject.Switches); It; ++It )
+	{
+		FGroupValue& Value = It.Value();
+		if( !Value.bPending )
+		{
+			continue;
+		}
+
+		Value.bPending = false;
+		if( bUseCommandQueue )
+		{
+			in_CommandQueue.EnqueueSetSwitch( It.Key(), Value.PendingValue, in_GameObjID );
+		}
+		else
+		{
+			AK::SoundEngine::SetSwitch( It.Key(), Value.PendingValue, in_GameObjID );
+		}
+		NumSubmitted++;
+	}
+
+	io_GameObject.bDirty = false;
+	return NumSubmitted;
+}
+
+void FAkParameterWriteCombiner::ForgetSubmittedRTPCs( AkGameObjectID in_GameObjID )
+{
+	if( !bEnabled )
+	{
+		return;
+	}
+
+	FScopeLock Lock(&CombinerCriticalSection);
+
+	FGameObjectValues* GameObject = GameObjects.Find( in_GameObjID );
+	if( GameObject )
+	{
+		for( TMap<AkRtpcID, FRtpcValue>::TIterator It(GameObject->Rtpcs); It; ++It )
+		{
+			It.Value().bSubmitted = false;
+		}
+	}
+
+	// The event may also change the global RTPCs.
+	FGameObjectValues* Global = ( in_GameObjID != AK_INVALID_GAME_OBJECT ) ? GameObjects.Find( AK_INVALID_GAME_OBJECT ) : NULL;
+	if( Global )
+	{
+		for( TMap<AkRtpcID, FRtpcValue>::TIterator It(Global->Rtpcs); It; ++It )
+		{
+			It.Value().bSubmitted = false;
+		}
+	}
+}
+
+void FAkParameterWriteCombiner::ForgetGameObject( AkGameObjectID in_GameObjID )
+{
+	FScopeLock Lock(&CombinerCriticalSection);
+	GameObjects.Remove( in_GameObjID );
+}
+
+FAkParameterWriteCombiner::FStats FAkParameterWriteCombiner::GetStats() const
+{
+	FScopeLock Lock(&CombinerCriticalSection);
+	return Stats;
+}
+
+void FAkParameterWriteCombiner::ResetStats()
+{
+	FScopeLock Lock(&CombinerCriticalSection);
+	FMemory::Memzero( Stats );
+}
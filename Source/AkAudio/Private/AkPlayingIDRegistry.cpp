@@ -0,0 +1,438 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkPlayingIDRegistry.cpp: Tracking of the events playing on each game object.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "AkPlayingIDRegistry.h"
+
+/*------------------------------------------------------------------------------------
+	FAkPlayingIDRegistry
+------------------------------------------------------------------------------------*/
+
+FAkPlayingIDRegistry::FAkPlayingIDRegistry()
+	: FreeHead(INDEX_NONE)
+{
+}
+
+void FAkPlayingIDRegistry::Term()
+{
+	// The sound engine is not called with the lock held: it may be waiting on a callback that needs it.
+	TArray<void*> PendingCookies;
+	{
+		FScopeLock Lock(&RegistryCriticalSection);
+		for( int32 Idx = 0; Idx < Slots.Num(); Idx++ )
+		{
+			if( Slots[Idx].bInUse )
+			{
+				PendingCookies.Add( IndexToCookie(Idx) );
+			}
+		}
+	}
+
+	for( int32 Idx = 0; Idx < PendingCookies.Num(); Idx++ )
+	{
+		AK::SoundEngine::CancelEventCallbackCookie( PendingCookies[Idx] );
+	}
+
+	FScopeLock Lock(&RegistryCriticalSection);
+	Slots.Empty();
+	GameObjects.Empty();
+	Events.Empty();
+	FreeHead = INDEX_NONE;
+}
+
+int32 FAkPlayingIDRegistry::AllocateSlot( AkGameObjectID in_GameObjID, AkUniqueID in_EventID )
+{
+	int32 Index = FreeHead;
+	if( Index != INDEX_NONE )
+	{
+		FreeHead = Slots[Index].Next;
+	}
+	else
+	{
+		Index = Slots.AddUninitialized();
+		Slots[Index].Generation = 0;
+	}
+
+	FSlot& Slot = Slots[Index];
+	Slot.PlayingID = AK_INVALID_PLAYING_ID;
+	Slot.GameObjID = in_GameObjID;
+	Slot.Callback = NULL;
+	Slot.Cookie = NULL;
+	Slot.Flags = 0;
+	Slot.EventID = in_EventID;
+	Slot.StartTime = FPlatformTime::Seconds();
+	Slot.Location = FVector::ZeroVector;
+	Slot.AttenuationScalingFactor = 1.0f;
+	Slot.Component = NULL;
+	Slot.bInUse = true;
+	Slot.bStolen = false;
+
+	// Link at the head of the game object's list.
+	FSlotList& List = GameObjects.FindOrAdd( in_GameObjID );
+	if( List.Num == 0 )
+	{
+		List.Head = INDEX_NONE;
+		List.NumStolen = 0;
+	}
+	Slot.Prev = INDEX_NONE;
+	Slot.Next = List.Head;
+	if( List.Head != INDEX_NONE )
+	{
+		Slots[List.Head].Prev = Index;
+	}
+	List.Head = Index;
+	List.Num++;
+
+	// And at the head of the event's list.
+	FSlotList& EventList = Events.FindOrAdd( in_EventID );
+	if( EventList.Num == 0 )
+	{
+		EventList.Head = INDEX_NONE;
+		EventList.NumStolen = 0;
+	}
+	Slot.EventPrev = INDEX_NONE;
+	Slot.EventNext = EventList.Head;
+	if( EventList.Head != INDEX_NONE )
+	{
+		Slots[EventList.Head].EventPrev = Index;
+	}
+	EventList.Head = Index;
+	EventList.Num++;
+
+	return Index;
+}
+
+void FAkPlayingIDRegistry::ReleaseSlot( int32 in_Index )
+{
+	FSlot& Slot = Slots[in_Index];
+	check( Slot.bInUse );
+
+	FSlotList* List = GameObjects.Find( Slot.GameObjID );
+	check( List );
+	if( Slot.Prev != INDEX_NONE )
+	{
+		Slots[Slot.Prev].Next = Slot.Next;
+	}
+	else
+	{
+		List->Head = Slot.Next;
+	}
+	if( Slot.Next != INDEX_NONE )
+	{
+		Slots[Slot.Next].Prev = Slot.Prev;
+	}
+	if( Slot.bStolen )
+	{
+		List->NumStolen--;
+	}
+	if( --List->Num == 0 )
+	{
+		GameObjects.Remove( Slot.GameObjID );
+	}
+
+	FSlotList* EventList = Events.Find( Slot.EventID );
+	check( EventList );
+	if( Slot.EventPrev != INDEX_NONE )
+	{
+		Slots[Slot.EventPrev].EventNext = Slot.EventNext;
+	}
+	else
+	{
+		EventList->Head = Slot.EventNext;
+	}
+	if( Slot.EventNext != INDEX_NONE )
+	{
+		Slots[Slot.EventNext].EventPrev = Slot.EventPrev;
+	}
+	if( Slot.bStolen )
+	{
+		EventList->NumStolen--;
+	}
+	if( --EventList->Num == 0 )
+	{
+		Events.Remove( Slot.EventID );
+	}
+
+	Slot.bInUse = false;
+	Slot.Generation++;
+	Slot.PlayingID = AK_INVALID_PLAYING_ID;
+	Slot.Next = FreeHead;
+	FreeHead = in_Index;
+}
+
+FAkPlayingIDRegistry::FHandle FAkPlayingIDRegistry::PostEvent(
+	AkUniqueID in_EventID,
+	AkGameObjectID in_GameObjID,
+	AkUInt32 in_uFlags,
+	AkCallbackFunc in_pfnCallback,
+	void * in_pCookie,
+	const FVector& in_Location,
+	float in_fAttenuationScalingFactor
+	)
+{
+	return PostEventInternal( in_EventID, in_GameObjID, in_uFlags, in_pfnCallback, in_pCookie, in_Location, in_fAttenuationScalingFactor, NULL );
+}
+
+FAkPlayingIDRegistry::FHandle FAkPlayingIDRegistry::PostEvent(
+	AkUniqueID in_EventID,
+	UAkComponent * in_pComponent,
+	AkUInt32 in_uFlags,
+	AkCallbackFunc in_pfnCallback,
+	void * in_pCookie
+	)
+{
+	return PostEventInternal( in_EventID, (AkGameObjectID) in_pComponent, in_uFlags, in_pfnCallback, in_pCookie, in_pComponent->GetComponentLocation(), in_pComponent->AttenuationScalingFactor, in_pComponent );
+}
+
+FAkPlayingIDRegistry::FHandle FAkPlayingIDRegistry::PostEventInternal(
+	AkUniqueID in_EventID,
+	AkGameObjectID in_GameObjID,
+	AkUInt32 in_uFlags,
+	AkCallbackFunc in_pfnCallback,
+	void * in_pCookie,
+	const FVector& in_Location,
+	float in_fAttenuationScalingFactor,
+	UAkComponent * in_pComponent
+	)
+{
+	FHandle Handle;
+	{
+		FScopeLock Lock(&RegistryCriticalSection);
+
+		const int32 Index = AllocateSlot( in_GameObjID, in_EventID );
+		FSlot& Slot = Slots[Index];
+		Slot.Callback = in_pfnCallback;
+		Slot.Cookie = in_pCookie;
+		Slot.Flags = in_pfnCallback ? in_uFlags : 0;
+		Slot.Location = in_Location;
+		Slot.AttenuationScalingFactor = in_fAttenuationScalingFactor;
+		Slot.Component = in_pComponent;
+
+		Handle.Index = (uint32)Index;
+		Handle.Generation = Slot.Generation;
+	}
+
+	// Posted without the lock held: the sound engine may be waiting on a callback that needs it.
+	const AkPlayingID PlayingID = AK::SoundEngine::PostEvent( in_EventID, in_GameObjID, in_uFlags | AK_EndOfEvent, &FAkPlayingIDRegistry::PlayingIDCallback, IndexToCookie(Handle.Index) );
+
+	FScopeLock Lock(&RegistryCriticalSection);
+
+	// The event may already have ended, in which case its slot was released by the callback.
+	FSlot& Slot = Slots[Handle.Index];
+	if( Slot.bInUse && Slot.Generation == Handle.Generation )
+	{
+		if( PlayingID == AK_INVALID_PLAYING_ID )
+		{
+			ReleaseSlot( Handle.Index );
+		}
+		else
+		{
+			Slot.PlayingID = PlayingID;
+		}
+	}
+
+	Handle.PlayingID = PlayingID;
+	return Handle;
+}
+
+void FAkPlayingIDRegistry::PlayingIDCallback( AkCallbackType in_eType, AkCallbackInfo* in_pCallbackInfo )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !AkAudioDevice )
+	{
+		return;
+	}
+
+	FAkPlayingIDRegistry& Registry = AkAudioDevice->GetPlayingIDRegistry();
+	FScopeLock Lock(&Registry.RegistryCriticalSection);
+
+	const int32 Index = CookieToIndex( in_pCallbackInfo->pCookie );
+	if( !Registry.Slots.IsValidIndex(Index) || !Registry.Slots[Index].bInUse )
+	{
+		return;
+	}
+
+	// Copied: the caller's callback may post events, which can grow the slot array.
+	const FSlot Slot = Registry.Slots[Index];
+	if( in_eType == AK_EndOfEvent )
+	{
+		Registry.ReleaseSlot( Index );
+	}
+
+	// Forwarded while locked, so that once CancelCookie returns the caller is never called back.
+	if( Slot.Callback && ( Slot.Flags & in_eType ) )
+	{
+		in_pCallbackInfo->pCookie = Slot.Cookie;
+		Slot.Callback( in_eType, in_pCallbackInfo );
+	}
+}
+
+bool FAkPlayingIDRegistry::IsPlaying( const FHandle& in_Handle ) const
+{
+	return GetPlayingID( in_Handle ) != AK_INVALID_PLAYING_ID;
+}
+
+AkPlayingID FAkPlayingIDRegistry::GetPlayingID( const FHandle& in_Handle ) const
+{
+	FScopeLock Lock(&RegistryCriticalSection);
+
+	if( in_Handle.IsValid() && Slots.IsValidIndex( (int32)in_Handle.Index ) )
+	{
+		const FSlot& Slot = Slots[in_Handle.Index];
+		if( Slot.bInUse && Slot.Generation == in_Handle.Generation )
+		{
+			return Slot.PlayingID;
+		}
+	}
+
+	return AK_INVALID_PLAYING_ID;
+}
+
+uint32 FAkPlayingIDRegistry::GetNumPlaying( AkGameObjectID in_GameObjID ) const
+{
+	FScopeLock Lock(&RegistryCriticalSection);
+
+	const FSlotList* List = GameObjects.Find( in_GameObjID );
+	return List ? List->Num : 0;
+}
+
+void FAkPlayingIDRegistry::GetPlayingIDs( AkGameObjectID in_GameObjID, TArray<AkPlayingID>& out_PlayingIDs ) const
+{
+	FScopeLock Lock(&RegistryCriticalSection);
+
+	out_PlayingIDs.Reset();
+	const FSlotList* List = GameObjects.Find( in_GameObjID );
+	if( List )
+	{
+		out_PlayingIDs.Reserve( List->Num );
+		for( int32 Index = List->Head; Index != INDEX_NONE; Index = Slots[Index].Next )
+		{
+			if( Slots[Index].PlayingID != AK_INVALID_PLAYING_ID )
+			{
+				out_PlayingIDs.Add( Slots[Index].PlayingID );
+			}
+		}
+	}
+}
+
+uint32 FAkPlayingIDRegistry::GetNumInstances( AkUniqueID in_EventID ) const
+{
+	FScopeLock Lock(&RegistryCriticalSection);
+
+	const FSlotList* EventList = Events.Find( in_EventID );
+	return EventList ? EventList->Num - EventList->NumStolen : 0;
+}
+
+uint32 FAkPlayingIDRegistry::GetNumInstances( AkUniqueID in_EventID, AkGameObjectID in_GameObjID ) const
+{
+	FScopeLock Lock(&RegistryCriticalSection);
+
+	// Walk the shorter of the two lists.
+	const FSlotList* List = GameObjects.Find( in_GameObjID );
+	const FSlotList* EventList = Events.Find( in_EventID );
+	if( List == NULL || EventList == NULL )
+	{
+		return 0;
+	}
+
+	uint32 NumInstances = 0;
+	if( List->Num <= EventList->Num )
+	{
+		for( int32 Index = List->Head; Index != INDEX_NONE; Index = Slots[Index].Next )
+		{
+			NumInstances += ( Slots[Index].EventID == in_EventID && !Slots[Index].bStolen ) ? 1 : 0;
+		}
+	}
+	else
+	{
+		for( int32 Index = EventList->Head; Index != INDEX_NONE; Index = Slots[Index].EventNext )
+		{
+			NumInstances += ( Slots[Index].GameObjID == in_GameObjID && !Slots[Index].bStolen ) ? 1 : 0;
+		}
+	}
+	return NumInstances;
+}
+
+AkPlayingID FAkPlayingIDRegistry::StealInstance( AkUniqueID in_EventID, AkGameObjectID in_GameObjID, EStealPolicy in_ePolicy, const TArray<FVector>& in_Listeners )
+{
+	FScopeLock Lock(&RegistryCriticalSection);
+
+	const FSlotList* EventList = Events.Find( in_EventID );
+	if( EventList == NULL )
+	{
+		return AK_INVALID_PLAYING_ID;
+	}
+
+	int32 Victim = INDEX_NONE;
+	double VictimScore = 0.0;
+	for( int32 Index = EventList->Head; Index != INDEX_NONE; Index = Slots[Index].EventNext )
+	{
+		const FSlot& Slot = Slots[Index];
+		if( Slot.bStolen || Slot.PlayingID == AK_INVALID_PLAYING_ID
+			|| ( in_GameObjID != AK_INVALID_GAME_OBJECT && Slot.GameObjID != in_GameObjID ) )
+		{
+			continue;
+		}
+
+		// Higher is a better candidate.
+		double Score;
+		if( in_ePolicy == StealOldest || in_Listeners.Num() == 0 )
+		{
+			Score = -Slot.StartTime;
+		}
+		else
+		{
+			// Components are ranked where they are now; the other emitters do not move.
+			const UAkComponent * Component = Slot.Component.Get();
+			const FVector Location = Component ? Component->GetComponentLocation() : Slot.Location;
+			const float AttenuationScalingFactor = Component ? Component->AttenuationScalingFactor : Slot.AttenuationScalingFactor;
+
+			float MinDistSquared = MAX_FLT;
+			for( int32 ListenerIdx = 0; ListenerIdx < in_Listeners.Num(); ListenerIdx++ )
+			{
+				MinDistSquared = FMath::Min( MinDistSquared, FVector::DistSquared( Location, in_Listeners[ListenerIdx] ) );
+			}
+			Score = MinDistSquared;
+			if( in_ePolicy == StealQuietest && AttenuationScalingFactor > 0.0f )
+			{
+				Score /= FMath::Square( AttenuationScalingFactor );
+			}
+		}
+
+		if( Victim == INDEX_NONE || Score > VictimScore )
+		{
+			Victim = Index;
+			VictimScore = Score;
+		}
+	}
+
+	if( Victim == INDEX_NONE )
+	{
+		return AK_INVALID_PLAYING_ID;
+	}
+
+	FSlot& Slot = Slots[Victim];
+	Slot.bStolen = true;
+	GameObjects.FindChecked( Slot.GameObjID ).NumStolen++;
+	Events.FindChecked( Slot.EventID ).NumStolen++;
+	return Slot.PlayingID;
+}
+
+void FAkPlayingIDRegistry::CancelCookie( void * in_pCookie )
+{
+	FScopeLock Lock(&RegistryCriticalSection);
+
+	for( int32 Idx = 0; Idx < Slots.Num(); Idx++ )
+	{
+		FSlot& Slot = Slots[Idx];
+		if( Slot.bInUse && Slot.Cookie == in_pCookie )
+		{
+			Slot.Callback = NULL;
+			Slot.Flags = 0;
+		}
+	}
+}
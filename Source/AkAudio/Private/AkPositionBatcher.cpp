@@ -0,0 +1,165 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkPositionBatcher.cpp: Once-per-frame submission of AkComponent positions.
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "AkPositionBatcher.h"
+
+/*------------------------------------------------------------------------------------
+	FAkPositionBatcher
+------------------------------------------------------------------------------------*/
+
+FAkPositionBatcher::FAkPositionBatcher()
+	: PositionEpsilonSquared(0.0f)
+	, MinOrientationDot(1.0f)
+	, bEnabled(false)
+{
+	FMemory::Memzero( Stats );
+}
+
+void FAkPositionBatcher::Init( float in_fPositionEpsilon, float in_fOrientationEpsilonDegrees )
+{
+	PositionEpsilonSquared = FMath::Square( FMath::Max( in_fPositionEpsilon, 0.0f ) );
+	MinOrientationDot = FMath::Cos( FMath::DegreesToRadians( FMath::Clamp( in_fOrientationEpsilonDegrees, 0.0f, 180.0f ) ) );
+	bEnabled = true;
+}
+
+void FAkPositionBatcher::Term()
+{
+	for( int32 Idx = 0; Idx < DirtyComponents.Num(); Idx++ )
+	{
+		DirtyComponents[Idx]->bPositionDirty = false;
+	}
+	DirtyComponents.Empty();
+	SubmittedComponents.Empty();
+	Positions.Empty();
+	Fronts.Empty();
+	SoundPositions.Empty();
+	bEnabled = false;
+}
+
+void FAkPositionBatcher::MarkDirty( UAkComponent * in_pComponent )
+{
+	Stats.NumMarked++;
+	if( !in_pComponent->bPositionDirty )
+	{
+		in_pComponent->bPositionDirty = true;
+		DirtyComponents.Add( in_pComponent );
+	}
+}
+
+void FAkPositionBatcher::Remove( UAkComponent * in_pComponent )
+{
+	if( in_pComponent->bPositionDirty )
+	{
+		in_pComponent->bPositionDirty = false;
+		DirtyComponents.RemoveSingleSwap( in_pComponent );
+	}
+	in_pComponent->bHasSubmittedPosition = false;
+}
+
+void FAkPositionBatcher::SubmitNow( FAkAudioDevice& in_AudioDevice, UAkComponent * in_pComponent )
+{
+	if( in_pComponent->bPositionDirty )
+	{
+		DirtyComponents.RemoveSingleSwap( in_pComponent );
+		Submit( in_AudioDevice, &in_pComponent, 1 );
+	}
+}
+
+uint32 FAkPositionBatcher::Flush( FAkAudioDevice& in_AudioDevice )
+{
+	if( DirtyComponents.Num() == 0 )
+	{
+		return 0;
+	}
+
+	const uint32 NumSubmitted = Submit( in_AudioDevice, DirtyComponents.GetData(), DirtyComponents.Num() );
+	DirtyComponents.Reset();
+	return NumSubmitted;
+}
+
+uint32 FAkPositionBatcher::Submit( FAkAudioDevice& in_AudioDevice, UAkComponent * const * in_ppComponents, int32 in_NumComponents )
+{
+	SubmittedComponents.Reset();
+	Positions.Reset();
+	Fronts.Reset();
+
+	// Gather the transforms that changed enough into contiguous arrays.
+	for( int32 Idx = 0; Idx < in_NumComponents; Idx++ )
+	{
+		UAkComponent * Component = in_ppComponents[Idx];
+		Component->bPositionDirty = false;
+		if( !Component->bIsActive )
+		{
+			continue;
+		}
+
+		const FTransform& Transform = Component->ComponentToWorld;
+		const FVector Position = Transform.GetTranslation();
+		const FVector Front = Transform.GetUnitAxis( EAxis::X );
+		if( Component->bHasSubmittedPosition
+			&& FVector::DistSquared( Position, Component->SubmittedPosition ) <= PositionEpsilonSquared
+			&& FVector::DotProduct( Front, Component->SubmittedFront ) >= MinOrientationDot )
+		{
+			Stats.NumSkipped++;
+			continue;
+		}
+
+		Component->SubmittedPosition = Position;
+		Component->SubmittedFront = Front;
+		Component->bHasSubmittedPosition = true;
+
+		SubmittedComponents.Add( Component );
+		Positions.Add( Position );
+		Fronts.Add( Front );
+	}
+
+	const int32 NumSubmitted = SubmittedComponents.Num();
+	if( NumSubmitted == 0 )
+	{
+		return 0;
+	}
+
+	// Convert them to the sound engine's coordinate system in one pass.
+	SoundPositions.SetNumUninitialized( NumSubmitted, false );
+	for( int32 Idx = 0; Idx < NumSubmitted; Idx++ )
+	{
+		FAkAudioDevice::FVectorToAKVector( Positions[Idx], SoundPositions[Idx].Position );
+		FAkAudioDevice::FVectorToAKVector( Fronts[Idx], SoundPositions[Idx].Orientation );
+	}
+
+	FAkAudioCommandQueue& CommandQueue = in_AudioDevice.GetCommandQueue();
+	if( CommandQueue.IsEnabled() )
+	{
+		for( int32 Idx = 0; Idx < NumSubmitted; Idx++ )
+		{
+			CommandQueue.EnqueueSetPosition( (AkGameObjectID) SubmittedComponents[Idx], SoundPositions[Idx] );
+		}
+	}
+	else
+	{
+		for( int32 Idx = 0; Idx < NumSubmitted; Idx++ )
+		{
+			AK::SoundEngine::SetPosition( (AkGameObjectID) SubmittedComponents[Idx], SoundPositions[Idx] );
+		}
+	}
+
+	// Find and apply all AkReverbVolumes at the new locations
+	if( in_AudioDevice.GetMaxAuxBus() > 0 )
+	{
+		for( int32 Idx = 0; Idx < NumSubmitted; Idx++ )
+		{
+			if( SubmittedComponents[Idx]->bUseReverbVolumes )
+			{
+				SubmittedComponents[Idx]->UpdateAkReverbVolumeList( Positions[Idx] );
+			}
+		}
+	}
+
+	Stats.NumSubmitted += (uint32)NumSubmitted;
+	return (uint32)NumSubmitted;
+}
@@ -9,6 +9,32 @@
 UAkSettings::UAkSettings(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, MaxSimultaneousReverbVolumes(4)
+	, bUseCommandQueue(false)
+	, CommandQueueSize(4096)
+	, CallbackQueueSize(1024)
+	, OneShotEmitterPoolSize(64)
+	, bCoalesceParameterWrites(false)
+	, RTPCCoalesceEpsilon(0.0f)
+	, bBatchPositionUpdates(false)
+	, PositionUpdateEpsilon(1.0f)
+	, OrientationUpdateEpsilon(1.0f)
+	, bCentralizedComponentUpdate(false)
+	, bParallelComponentUpdate(false)
+	, bEnableComponentDormancy(false)
+	, ComponentPoolSize(0)
+	, bLazyGameObjectRegistration(false)
+	, GameObjectIdleTimeout(5.0f)
+	, bEnableAudibilityCulling(false)
+	, AudibilityCullingMargin(200.0f)
+	, bVirtualizeAmbientSounds(false)
+	, AmbientVirtualizationHysteresis(500.0f)
+	, AmbientVirtualizationInterval(0.25f)
+	, bSeekRestartedAmbientSounds(true)
+	, ImpactBucketSize(400.0f)
+	, MaxImpactsPerBucket(2)
+	, CrowdCellSize(1500.0f)
+	, MaxIndividualCrowdAgents(8)
+	, CrowdCellReleaseDelay(2.0f)
 {
 	TCHAR WwiseDir[MAX_PATH];
 	FPlatformMisc::GetEnvironmentVariable(TEXT("WWISEROOT"), WwiseDir, MAX_PATH);
@@ -0,0 +1,23 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkSplineAmbientSound.cpp:
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "Components/SplineComponent.h"
+
+/*------------------------------------------------------------------------------------
+	AAkSplineAmbientSound
+------------------------------------------------------------------------------------*/
+
+AAkSplineAmbientSound::AAkSplineAmbientSound(const class FObjectInitializer& ObjectInitializer) :
+Super(ObjectInitializer.SetDefaultSubobjectClass<UAkSplineEmitterComponent>(TEXT("AkAudioComponent0")))
+{
+	// Property initialization
+	Spline = ObjectInitializer.CreateDefaultSubobject<USplineComponent>(this, TEXT("Spline0"));
+	Spline->AttachParent = AkComponent;
+
+	CastChecked<UAkSplineEmitterComponent>(AkComponent)->Spline = Spline;
+}
@@ -0,0 +1,305 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkSplineEmitterComponent.cpp:
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "Components/SplineComponent.h"
+
+/*------------------------------------------------------------------------------------
+	UAkSplineEmitterComponent
+------------------------------------------------------------------------------------*/
+
+UAkSplineEmitterComponent::UAkSplineEmitterComponent(const class FObjectInitializer& ObjectInitializer) :
+Super(ObjectInitializer)
+{
+	// Property initialization
+	Spline = NULL;
+	SampleSpacing = 100.0f;
+	FullSearchInterval = 1.0f;
+
+	ReverbQueryPoint = FVector::ZeroVector;
+	bHasReverbQueryPoint = false;
+	TimeToFullSearch = 0.0f;
+}
+
+void UAkSplineEmitterComponent::SetSpline( USplineComponent * in_pSpline )
+{
+	Spline = in_pSpline;
+	RefreshSpline();
+}
+
+void UAkSplineEmitterComponent::RefreshSpline()
+{
+	SampleSpline();
+	UpdateGameObjectPosition();
+}
+
+FVector UAkSplineEmitterComponent::GetClosestPointToListener( int32 in_iListenerIndex ) const
+{
+	return ClosestPoints.IsValidIndex( in_iListenerIndex ) ? ClosestPoints[in_iListenerIndex] : GetComponentLocation();
+}
+
+void UAkSplineEmitterComponent::OnRegister()
+{
+	if( Spline == NULL && GetOwner() )
+	{
+		Spline = GetOwner()->FindComponentByClass<USplineComponent>();
+	}
+
+	Super::OnRegister();
+}
+
+void UAkSplineEmitterComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+	// Done first, so that the occlusion computed by the AkComponent traces from the new points.
+	if( Spline && bIsActive && AK::SoundEngine::IsInitialized() )
+	{
+		bool bFullSearch = false;
+		if( !Spline->ComponentToWorld.Equals( SampledSplineTransform ) || SamplePoints.Num() == 0 )
+		{
+			SampleSpline();
+			bFullSearch = true;
+		}
+
+		TimeToFullSearch -= DeltaTime;
+		if( TimeToFullSearch <= 0.0f )
+		{
+			TimeToFullSearch = FullSearchInterval;
+			bFullSearch = true;
+		}
+
+		UpdateClosestPoints( bFullSearch );
+	}
+
+	Super::TickComponent( DeltaTime, TickType, ThisTickFunction );
+}
+
+bool UAkSplineEmitterComponent::IsOutOfAudibleRange( const UAkAudioEvent * in_pEvent ) const
+{
+	if( Spline == NULL )
+	{
+		return Super::IsOutOfAudibleRange( in_pEvent );
+	}
+
+	// Out of range of every listener from the closest point means out of range from the whole spline.
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	return AkAudioDevice && AkAudioDevice->IsOutOfAudibleRange( in_pEvent, GetClosestPointToListeners(), AttenuationScalingFactor );
+}
+
+void UAkSplineEmitterComponent::UpdateGameObjectPosition()
+{
+	if( Spline == NULL )
+	{
+		Super::UpdateGameObjectPosition();
+		return;
+	}
+
+	if( !Spline->ComponentToWorld.Equals( SampledSplineTransform ) || SamplePoints.Num() == 0 )
+	{
+		SampleSpline();
+	}
+
+	// Forget the points last sent, so that the new ones are sent even if they did not move.
+	ClosestPoints.Reset();
+	UpdateClosestPoints( true );
+}
+
+FVector UAkSplineEmitterComponent::GetReverbVolumeQueryPosition() const
+{
+	return GetClosestPointToListeners();
+}
+
+FVector UAkSplineEmitterComponent::GetOcclusionSourcePosition( const FVector& in_ListenerPosition ) const
+{
+	if( SamplePoints.Num() == 0 )
+	{
+		return GetComponentLocation();
+	}
+
+	// The closest points of this frame, when the position is one of the listeners'. They are not updated while dormant.
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( AkAudioDevice && !IsDormant() )
+	{
+		const int32 ListenerIdx = AkAudioDevice->GetListenerPositions().IndexOfByKey( in_ListenerPosition );
+		if( ClosestPoints.IsValidIndex( ListenerIdx ) )
+		{
+			return ClosestPoints[ListenerIdx];
+		}
+	}
+
+	return GetClosestPointOnSegment( FindClosestSegment( in_ListenerPosition ), in_ListenerPosition );
+}
+
+#if WITH_EDITOR
+void UAkSplineEmitterComponent::PostEditChangeProperty( FPropertyChangedEvent& PropertyChangedEvent )
+{
+	Super::PostEditChangeProperty( PropertyChangedEvent );
+
+	if( IsRegistered() )
+	{
+		RefreshSpline();
+	}
+}
+#endif
+
+void UAkSplineEmitterComponent::SampleSpline()
+{
+	SamplePoints.Reset();
+	ListenerSegments.Reset();
+	ClosestPoints.Reset();
+	bHasReverbQueryPoint = false;
+
+	if( Spline == NULL )
+	{
+		return;
+	}
+
+	SampledSplineTransform = Spline->ComponentToWorld;
+
+	// At least one segment, even for a spline without length, so that there is always a closest point.
+	const float SplineLength = Spline->GetSplineLength();
+	const int32 NumSegments = FMath::Max( FMath::CeilToInt( SplineLength / FMath::Max( SampleSpacing, 1.0f ) ), 1 );
+	SamplePoints.Reserve( NumSegments + 1 );
+	for( int32 PointIdx = 0; PointIdx <= NumSegments; PointIdx++ )
+	{
+		SamplePoints.Add( Spline->GetLocationAtDistanceAlongSpline( SplineLength * PointIdx / NumSegments, ESplineCoordinateSpace::World ) );
+	}
+}
+
+void UAkSplineEmitterComponent::UpdateClosestPoints( bool in_bFullSearch )
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !bIsActive || !IsGameObjectRegistered() || !AkAudioDevice || SamplePoints.Num() == 0 )
+	{
+		return;
+	}
+
+	const TArray<FVector>& ListenerPositions = AkAudioDevice->GetListenerPositions();
+	const int32 NumListeners = ListenerPositions.Num();
+	if( NumListeners == 0 )
+	{
+		return;
+	}
+
+	bool bChanged = ClosestPoints.Num() != NumListeners;
+	ListenerSegments.SetNum( NumListeners );
+	ClosestPoints.SetNum( NumListeners );
+
+	for( int32 ListenerIdx = 0; ListenerIdx < NumListeners; ListenerIdx++ )
+	{
+		const FVector& ListenerPosition = ListenerPositions[ListenerIdx];
+		const int32 Segment = ( in_bFullSearch || bChanged )
+			? FindClosestSegment( ListenerPosition )
+			: WalkToClosestSegment( ListenerSegments[ListenerIdx], ListenerPosition );
+
+		const FVector ClosestPoint = GetClosestPointOnSegment( Segment, ListenerPosition );
+		bChanged |= !ClosestPoint.Equals( ClosestPoints[ListenerIdx] );
+		ListenerSegments[ListenerIdx] = Segment;
+		ClosestPoints[ListenerIdx] = ClosestPoint;
+	}
+
+	if( !bChanged )
+	{
+		return;
+	}
+
+	// With several listeners, each one hears its own closest point the loudest.
+	SetGameObjectPositions( ClosestPoints.GetData(), NumListeners, AK::SoundEngine::MultiPositionType_MultiDirections );
+
+	// The reverb volumes only change over distances of the order of the sampling.
+	const FVector ReverbPoint = GetClosestPointToListeners();
+	if( !bHasReverbQueryPoint || FVector::DistSquared( ReverbPoint, ReverbQueryPoint ) > FMath::Square( SampleSpacing ) )
+	{
+		ReverbQueryPoint = ReverbPoint;
+		bHasReverbQueryPoint = true;
+		UpdateReverbVolumesAtPosition();
+	}
+}
+
+FVector UAkSplineEmitterComponent::GetClosestPointOnSegment( int32 in_iSegment, const FVector& in_Position ) const
+{
+	return FMath::ClosestPointOnSegment( in_Position, SamplePoints[in_iSegment], SamplePoints[in_iSegment + 1] );
+}
+
+int32 UAkSplineEmitterComponent::FindClosestSegment( const FVector& in_Position ) const
+{
+	int32 ClosestSegment = 0;
+	float ClosestDistanceSquared = MAX_FLT;
+	const int32 NumSegments = SamplePoints.Num() - 1;
+	for( int32 Segment = 0; Segment < NumSegments; Segment++ )
+	{
+		const float DistanceSquared = FVector::DistSquared( GetClosestPointOnSegment( Segment, in_Position ), in_Position );
+		if( DistanceSquared < ClosestDistanceSquared )
+		{
+			ClosestDistanceSquared = DistanceSquared;
+			ClosestSegment = Segment;
+		}
+	}
+	return ClosestSegment;
+}
+
+int32 UAkSplineEmitterComponent::WalkToClosestSegment( int32 in_iStartSegment, const FVector& in_Position ) const
+{
+	const int32 NumSegments = SamplePoints.Num() - 1;
+	int32 Segment = FMath::Clamp( in_iStartSegment, 0, NumSegments - 1 );
+	float DistanceSquared = FVector::DistSquared( GetClosestPointOnSegment( Segment, in_Position ), in_Position );
+
+	// Each step gets strictly closer, so the walk ends.
+	for( ;; )
+	{
+		int32 NextSegment = Segment;
+		float NextDistanceSquared = DistanceSquared;
+		for( int32 Neighbour = Segment - 1; Neighbour <= Segment + 1; Neighbour += 2 )
+		{
+			if( Neighbour >= 0 && Neighbour < NumSegments )
+			{
+				const float NeighbourDistanceSquared = FVector::DistSquared( GetClosestPointOnSegment( Neighbour, in_Position ), in_Position );
+				if( NeighbourDistanceSquared < NextDistanceSquared )
+				{
+					NextSegment = Neighbour;
+					NextDistanceSquared = NeighbourDistanceSquared;
+				}
+			}
+		}
+
+		if( NextSegment == Segment )
+		{
+			return Segment;
+		}
+		Segment = NextSegment;
+		DistanceSquared = NextDistanceSquared;
+	}
+}
+
+FVector UAkSplineEmitterComponent::GetClosestPointToListeners() const
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( SamplePoints.Num() == 0 || !AkAudioDevice || AkAudioDevice->GetListenerPositions().Num() == 0 )
+	{
+		return GetComponentLocation();
+	}
+
+	// Walked from the segments of the last update, as the listeners may have moved since.
+	const TArray<FVector>& ListenerPositions = AkAudioDevice->GetListenerPositions();
+	FVector ClosestPoint = FVector::ZeroVector;
+	float ClosestDistanceSquared = MAX_FLT;
+	for( int32 ListenerIdx = 0; ListenerIdx < ListenerPositions.Num(); ListenerIdx++ )
+	{
+		const FVector& ListenerPosition = ListenerPositions[ListenerIdx];
+		const int32 Segment = ListenerSegments.IsValidIndex( ListenerIdx )
+			? WalkToClosestSegment( ListenerSegments[ListenerIdx], ListenerPosition )
+			: FindClosestSegment( ListenerPosition );
+
+		const FVector Point = GetClosestPointOnSegment( Segment, ListenerPosition );
+		const float DistanceSquared = FVector::DistSquared( Point, ListenerPosition );
+		if( DistanceSquared < ClosestDistanceSquared )
+		{
+			ClosestDistanceSquared = DistanceSquared;
+			ClosestPoint = Point;
+		}
+	}
+	return ClosestPoint;
+}
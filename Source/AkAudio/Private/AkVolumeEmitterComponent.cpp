@@ -0,0 +1,361 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkVolumeEmitterComponent.cpp:
+=============================================================================*/
+
+#include "AkAudioDevice.h"
+#include "AkAudioClasses.h"
+#include "Components/BrushComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+
+/** Distance from a plane under which a vertex is considered on it, in world units */
+static const float HULL_PLANE_TOLERANCE = 0.1f;
+
+/** Maximum number of passes over the planes of a hull when projecting a position on it */
+static const int32 MAX_HULL_PROJECTION_PASSES = 8;
+
+/** Distance the closest point moves before the reverb volumes are looked up again, in world units */
+static const float REVERB_QUERY_DISTANCE = 100.0f;
+
+/*------------------------------------------------------------------------------------
+	UAkVolumeEmitterComponent
+------------------------------------------------------------------------------------*/
+
+UAkVolumeEmitterComponent::UAkVolumeEmitterComponent(const class FObjectInitializer& ObjectInitializer) :
+Super(ObjectInitializer)
+{
+	// Property initialization
+	Brush = NULL;
+
+	bHasHullPlanes = false;
+	ReverbQueryPoint = FVector::ZeroVector;
+	bHasReverbQueryPoint = false;
+}
+
+void UAkVolumeEmitterComponent::SetBrush( UBrushComponent * in_pBrush )
+{
+	Brush = in_pBrush;
+	RefreshBrush();
+}
+
+void UAkVolumeEmitterComponent::RefreshBrush()
+{
+	BuildHullPlanes();
+	UpdateGameObjectPosition();
+}
+
+FVector UAkVolumeEmitterComponent::GetClosestPointToListener( int32 in_iListenerIndex ) const
+{
+	return ClosestPoints.IsValidIndex( in_iListenerIndex ) ? ClosestPoints[in_iListenerIndex] : GetComponentLocation();
+}
+
+void UAkVolumeEmitterComponent::OnRegister()
+{
+	if( Brush == NULL && GetOwner() )
+	{
+		Brush = GetOwner()->FindComponentByClass<UBrushComponent>();
+	}
+
+	Super::OnRegister();
+}
+
+void UAkVolumeEmitterComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+	// Done first, so that the occlusion computed by the AkComponent traces from the new points.
+	if( Brush && bIsActive && AK::SoundEngine::IsInitialized() )
+	{
+		RefreshHullPlanesIfMoved();
+		UpdateClosestPoints();
+	}
+
+	Super::TickComponent( DeltaTime, TickType, ThisTickFunction );
+}
+
+bool UAkVolumeEmitterComponent::IsOutOfAudibleRange( const UAkAudioEvent * in_pEvent ) const
+{
+	if( Brush == NULL )
+	{
+		return Super::IsOutOfAudibleRange( in_pEvent );
+	}
+
+	// Out of range of every listener from the closest point means out of range from the whole brush.
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	return AkAudioDevice && AkAudioDevice->IsOutOfAudibleRange( in_pEvent, GetClosestPointToListeners(), AttenuationScalingFactor );
+}
+
+void UAkVolumeEmitterComponent::UpdateGameObjectPosition()
+{
+	if( Brush == NULL )
+	{
+		Super::UpdateGameObjectPosition();
+		return;
+	}
+
+	RefreshHullPlanesIfMoved();
+
+	// Forget the points last sent, so that the new ones are sent even if they did not move.
+	ClosestPoints.Reset();
+	UpdateClosestPoints();
+}
+
+FVector UAkVolumeEmitterComponent::GetReverbVolumeQueryPosition() const
+{
+	return GetClosestPointToListeners();
+}
+
+FVector UAkVolumeEmitterComponent::GetOcclusionSourcePosition( const FVector& in_ListenerPosition ) const
+{
+	// The closest points of this frame, when the position is one of the listeners'. They are not updated while dormant.
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( AkAudioDevice && !IsDormant() )
+	{
+		const int32 ListenerIdx = AkAudioDevice->GetListenerPositions().IndexOfByKey( in_ListenerPosition );
+		if( ClosestPoints.IsValidIndex( ListenerIdx ) )
+		{
+			return ClosestPoints[ListenerIdx];
+		}
+	}
+
+	return GetClosestPointInBrush( in_ListenerPosition );
+}
+
+void UAkVolumeEmitterComponent::BuildHullPlanes()
+{
+	HullPlanes.Reset();
+	HullPlaneStarts.Reset();
+	ClosestPoints.Reset();
+	bHasReverbQueryPoint = false;
+	bHasHullPlanes = false;
+
+	if( Brush == NULL )
+	{
+		return;
+	}
+
+	HulledBrushTransform = Brush->ComponentToWorld;
+	bHasHullPlanes = true;
+
+	UBodySetup * BodySetup = Brush->BrushBodySetup;
+	if( BodySetup == NULL )
+	{
+		return;
+	}
+
+	HullPlaneStarts.Add( 0 );
+
+	TArray<FVector> Vertices;
+	const TArray<FKConvexElem>& ConvexElems = BodySetup->AggGeom.ConvexElems;
+	for( int32 ElemIdx = 0; ElemIdx < ConvexElems.Num(); ElemIdx++ )
+	{
+		Vertices.Reset();
+		for( int32 VertexIdx = 0; VertexIdx < ConvexElems[ElemIdx].VertexData.Num(); VertexIdx++ )
+		{
+			Vertices.Add( HulledBrushTransform.TransformPosition( ConvexElems[ElemIdx].VertexData[VertexIdx] ) );
+		}
+
+		// The planes of the hull are those through three vertices that have every vertex on one side.
+		// Brush hulls have few vertices, and this only runs when the brush moves.
+		const int32 HullStart = HullPlanes.Num();
+		const int32 NumVertices = Vertices.Num();
+		for( int32 I = 0; I < NumVertices; I++ )
+		{
+			for( int32 J = I + 1; J < NumVertices; J++ )
+			{
+				for( int32 K = J + 1; K < NumVertices; K++ )
+				{
+					FVector Normal = ( Vertices[J] - Vertices[I] ) ^ ( Vertices[K] - Vertices[I] );
+					if( !Normal.Normalize() )
+					{
+						continue;
+					}
+
+					FPlane Plane( Vertices[I], Normal );
+					bool bHasAbove = false;
+					bool bHasBelow = false;
+					for( int32 VertexIdx = 0; VertexIdx < NumVertices && !( bHasAbove && bHasBelow ); VertexIdx++ )
+					{
+						const float Distance = Plane.PlaneDot( Vertices[VertexIdx] );
+						bHasAbove |= Distance > HULL_PLANE_TOLERANCE;
+						bHasBelow |= Distance < -HULL_PLANE_TOLERANCE;
+					}
+
+					if( bHasAbove == bHasBelow )
+					{
+						continue;
+					}
+
+					// Keep the planes facing out of the hull.
+					if( bHasAbove )
+					{
+						Plane = Plane.Flip();
+					}
+
+					bool bDuplicate = false;
+					for( int32 PlaneIdx = HullStart; PlaneIdx < HullPlanes.Num() && !bDuplicate; PlaneIdx++ )
+					{
+						bDuplicate = ( (FVector)HullPlanes[PlaneIdx] | (FVector)Plane ) > 1.0f - KINDA_SMALL_NUMBER
+							&& FMath::Abs( HullPlanes[PlaneIdx].W - Plane.W ) < HULL_PLANE_TOLERANCE;
+					}
+
+					if( !bDuplicate )
+					{
+						HullPlanes.Add( Plane );
+					}
+				}
+			}
+		}
+
+		// Degenerate hulls, without volume, are left out.
+		if( HullPlanes.Num() - HullStart < 4 )
+		{
+			HullPlanes.SetNum( HullStart, false );
+		}
+		else
+		{
+			HullPlaneStarts.Add( HullPlanes.Num() );
+		}
+	}
+}
+
+void UAkVolumeEmitterComponent::RefreshHullPlanesIfMoved()
+{
+	if( !bHasHullPlanes || !Brush->ComponentToWorld.Equals( HulledBrushTransform ) )
+	{
+		BuildHullPlanes();
+	}
+}
+
+void UAkVolumeEmitterComponent::UpdateClosestPoints()
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( !bIsActive || !IsGameObjectRegistered() || !AkAudioDevice || HullPlaneStarts.Num() < 2 )
+	{
+		return;
+	}
+
+	const TArray<FVector>& ListenerPositions = AkAudioDevice->GetListenerPositions();
+	const int32 NumListeners = ListenerPositions.Num();
+	if( NumListeners == 0 )
+	{
+		return;
+	}
+
+	bool bChanged = ClosestPoints.Num() != NumListeners;
+	ClosestPoints.SetNum( NumListeners );
+
+	for( int32 ListenerIdx = 0; ListenerIdx < NumListeners; ListenerIdx++ )
+	{
+		const FVector ClosestPoint = GetClosestPointInBrush( ListenerPositions[ListenerIdx] );
+		bChanged |= !ClosestPoint.Equals( ClosestPoints[ListenerIdx] );
+		ClosestPoints[ListenerIdx] = ClosestPoint;
+	}
+
+	if( !bChanged )
+	{
+		return;
+	}
+
+	// With several listeners, each one hears its own closest point the loudest.
+	SetGameObjectPositions( ClosestPoints.GetData(), NumListeners, AK::SoundEngine::MultiPositionType_MultiDirections );
+
+	const FVector ReverbPoint = GetClosestPointToListeners();
+	if( !bHasReverbQueryPoint || FVector::DistSquared( ReverbPoint, ReverbQueryPoint ) > FMath::Square( REVERB_QUERY_DISTANCE ) )
+	{
+		ReverbQueryPoint = ReverbPoint;
+		bHasReverbQueryPoint = true;
+		UpdateReverbVolumesAtPosition();
+	}
+}
+
+FVector UAkVolumeEmitterComponent::GetClosestPointInBrush( const FVector& in_Position ) const
+{
+	const int32 NumHulls = HullPlaneStarts.Num() - 1;
+	if( NumHulls <= 0 )
+	{
+		return GetComponentLocation();
+	}
+
+	FVector ClosestPoint = in_Position;
+	float ClosestDistanceSquared = MAX_FLT;
+	for( int32 Hull = 0; Hull < NumHulls; Hull++ )
+	{
+		bool bInside = true;
+		for( int32 PlaneIdx = HullPlaneStarts[Hull]; PlaneIdx < HullPlaneStarts[Hull + 1] && bInside; PlaneIdx++ )
+		{
+			bInside = HullPlanes[PlaneIdx].PlaneDot( in_Position ) <= 0.0f;
+		}
+
+		if( bInside )
+		{
+			return in_Position;
+		}
+
+		const FVector Point = GetClosestPointInHull( Hull, in_Position );
+		const float DistanceSquared = FVector::DistSquared( Point, in_Position );
+		if( DistanceSquared < ClosestDistanceSquared )
+		{
+			ClosestDistanceSquared = DistanceSquared;
+			ClosestPoint = Point;
+		}
+	}
+	return ClosestPoint;
+}
+
+FVector UAkVolumeEmitterComponent::GetClosestPointInHull( int32 in_iHull, const FVector& in_Position ) const
+{
+	const FPlane * Planes = HullPlanes.GetData() + HullPlaneStarts[in_iHull];
+	const int32 NumPlanes = HullPlaneStarts[in_iHull + 1] - HullPlaneStarts[in_iHull];
+
+	// Dykstra's alternating projections on the half-spaces of the planes. Unlike plain alternating
+	// projections, the correction kept for each plane makes it converge to the closest point, not
+	// just to any point of the hull. When a single face is closest, the second pass finds nothing to move.
+	TArray<FVector, TInlineAllocator<32> > Corrections;
+	Corrections.SetNumZeroed( NumPlanes );
+
+	FVector Point = in_Position;
+	for( int32 Pass = 0; Pass < MAX_HULL_PROJECTION_PASSES; Pass++ )
+	{
+		float MaxMoveSquared = 0.0f;
+		for( int32 PlaneIdx = 0; PlaneIdx < NumPlanes; PlaneIdx++ )
+		{
+			const FVector Corrected = Point + Corrections[PlaneIdx];
+			const float Distance = Planes[PlaneIdx].PlaneDot( Corrected );
+			const FVector Projected = Distance > 0.0f ? Corrected - (FVector)Planes[PlaneIdx] * Distance : Corrected;
+
+			Corrections[PlaneIdx] = Corrected - Projected;
+			MaxMoveSquared = FMath::Max( MaxMoveSquared, FVector::DistSquared( Point, Projected ) );
+			Point = Projected;
+		}
+
+		if( MaxMoveSquared < FMath::Square( HULL_PLANE_TOLERANCE ) )
+		{
+			break;
+		}
+	}
+	return Point;
+}
+
+FVector UAkVolumeEmitterComponent::GetClosestPointToListeners() const
+{
+	FAkAudioDevice * AkAudioDevice = FAkAudioDevice::Get();
+	if( HullPlaneStarts.Num() < 2 || !AkAudioDevice || AkAudioDevice->GetListenerPositions().Num() == 0 )
+	{
+		return GetComponentLocation();
+	}
+
+	const TArray<FVector>& ListenerPositions = AkAudioDevice->GetListenerPositions();
+	FVector ClosestPoint = FVector::ZeroVector;
+	float ClosestDistanceSquared = MAX_FLT;
+	for( int32 ListenerIdx = 0; ListenerIdx < ListenerPositions.Num(); ListenerIdx++ )
+	{
+		const FVector Point = GetClosestPointInBrush( ListenerPositions[ListenerIdx] );
+		const float DistanceSquared = FVector::DistSquared( Point, ListenerPositions[ListenerIdx] );
+		if( DistanceSquared < ClosestDistanceSquared )
+		{
+			ClosestDistanceSquared = DistanceSquared;
+			ClosestPoint = Point;
+		}
+	}
+	return ClosestPoint;
+}
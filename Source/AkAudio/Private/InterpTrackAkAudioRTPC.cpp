@@ -60,7 +60,7 @@ void UInterpTrackAkAudioRTPC::UpdateTrack(float NewPosition, UInterpTrackInst* T
 	FAkAudioDevice * AudioDevice = FAkAudioDevice::Get();
 	if( AudioDevice && Param.Len() )
 	{
-		AudioDevice->SetRTPCValue( *Param, NewFloatValue, 0, Actor );
+		AudioDevice->SetRTPCValue( FAkAudioDevice::GetIDFromName(FName(*Param)), NewFloatValue, 0, Actor );
 	}
 }
 
@@ -0,0 +1,128 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkAmbientVirtualizer.h: Game-side virtualization of looping ambient sounds.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+class AAkAmbientSound;
+
+/*------------------------------------------------------------------------------------
+	Ambient virtualizer
+------------------------------------------------------------------------------------*/
+
+/**
+ * Stops the looping events of the AkAmbientSounds that no listener can hear, and posts them
+ * again when a listener comes back, so that inaudible ambiences cost neither voices nor
+ * game object updates.
+ *
+ * An ambient sound is virtualized once every listener is farther than the audible radius of
+ * its event (MaxAttenuationRadius times the attenuation scaling factor) plus the hysteresis:
+ * its event is stopped and its game object unregistered, while the ambient sound is still
+ * considered playing. It is restarted once a listener is within the audible radius. When
+ * seeking is enabled, a restarted loop seeks to where it would be had it kept playing, using
+ * the duration of the loop notified when it was first posted.
+ *
+ * Distances are measured from the point of the emitter closest to each listener, so spline
+ * ambient sounds are virtualized by their closest point. The checks are spread over the
+ * frames, every ambient sound being checked once per check interval.
+ *
+ * Only used from the game thread.
+ */
+class AKAUDIO_API FAkAmbientVirtualizer
+{
+public:
+	/** Counters since the last call to ResetStats */
+	struct FStats
+	{
+		/** Distance checks made */
+		uint32 NumChecked;
+		/** Ambient sounds stopped because no listener could hear them */
+		uint32 NumVirtualized;
+		/** Virtualized ambient sounds posted again */
+		uint32 NumRestarted;
+	};
+
+	FAkAmbientVirtualizer();
+
+	/**
+	 * Start virtualizing the looping ambient sounds started from now on.
+	 *
+	 * @param in_fHysteresis		Distance beyond the audible radius at which an ambient sound is virtualized, in game units
+	 * @param in_fCheckInterval		Time in which every ambient sound is checked once, in seconds. 0 checks all of them every frame.
+	 * @param in_bSeekOnRestart		Seek restarted loops to where they would be had they kept playing
+	 */
+	void Init( float in_fHysteresis, float in_fCheckInterval, bool in_bSeekOnRestart );
+
+	/**
+	 * Forget every ambient sound and stop virtualizing. Virtualized ambient sounds stay silent until they are started again.
+	 */
+	void Term();
+
+	bool IsEnabled() const
+	{
+		return bEnabled;
+	}
+
+	bool ShouldSeekOnRestart() const
+	{
+		return bSeekOnRestart;
+	}
+
+	/** Start checking an ambient sound that is playing a looping event. Does nothing if it is already checked. */
+	void Add( AAkAmbientSound * in_pAmbientSound );
+
+	/** Stop checking an ambient sound. Does nothing if it is not checked. */
+	void Remove( AAkAmbientSound * in_pAmbientSound );
+
+	/** Number of ambient sounds checked */
+	int32 GetNumAmbientSounds() const
+	{
+		return AmbientSounds.Num();
+	}
+
+	/**
+	 * Check the share of the ambient sounds due this frame, and virtualize or restart them. Called once per frame by the device.
+	 *
+	 * @param in_fDeltaTime		Time elapsed since the last update, in seconds
+	 * @param in_Listeners		Listener positions. Nothing is checked without listeners.
+	 * @return The number of ambient sounds that were virtualized or restarted
+	 */
+	uint32 Update( float in_fDeltaTime, const TArray<FVector>& in_Listeners );
+
+	FStats GetStats() const
+	{
+		return Stats;
+	}
+
+	void ResetStats()
+	{
+		FMemory::Memzero( Stats );
+	}
+
+private:
+	/** Virtualize or restart an ambient sound depending on its distance to the listeners */
+	bool CheckAmbientSound( AAkAmbientSound * in_pAmbientSound, const TArray<FVector>& in_Listeners );
+
+	/** Remove the entry at an index, moving the last one in its place */
+	void RemoveAt( int32 in_Index );
+
+	/** Checked ambient sounds. Weak, in case one goes away without ending play. */
+	TArray< TWeakObjectPtr<AAkAmbientSound> > AmbientSounds;
+
+	/** Index of the next ambient sound to check */
+	int32 NextCheck;
+
+	/** Checks earned by the time elapsed, carried over from frame to frame */
+	float CheckBudget;
+
+	float Hysteresis;
+	float CheckInterval;
+	bool bSeekOnRestart;
+	bool bEnabled;
+
+	FStats Stats;
+};
@@ -0,0 +1,184 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkAudioCommandQueue.h: Deferred submission of sound engine commands.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+#include "AkInclude.h"
+
+/*------------------------------------------------------------------------------------
+	Sound engine command
+------------------------------------------------------------------------------------*/
+
+/**
+ * A compact, typed sound engine call. Everything is stored by value and by Wwise ID,
+ * so that a command can be written from any thread and executed later.
+ */
+struct FAkAudioCommand
+{
+	enum EType
+	{
+		PostEvent,
+		PostTrigger,
+		SetRTPCValue,
+		SetSwitch,
+		SetState,
+		SetPosition,
+		SetAuxSends,
+		SetObstructionOcclusion,
+		SetAttenuationScalingFactor,
+		SetActiveListeners,
+		StopAll,
+		StopPlayingID
+	};
+
+	EType Type;
+	AkGameObjectID GameObjID;
+
+	union
+	{
+		struct
+		{
+			AkUniqueID EventID;
+			AkUInt32 Flags;
+			AkCallbackFunc Callback;
+			void* Cookie;
+		} Event;
+
+		struct
+		{
+			AkUniqueID GroupID;
+			AkUniqueID ValueID;
+		} Group;
+
+		struct
+		{
+			AkRtpcID RtpcID;
+			AkRtpcValue Value;
+			AkTimeMs InterpolationTimeMs;
+		} Rtpc;
+
+		struct
+		{
+			AkUInt32 ListenerIndex;
+			AkReal32 Obstruction;
+			AkReal32 Occlusion;
+		} ObstructionOcclusion;
+
+		struct
+		{
+			AkAuxSendValue Values[AK_MAX_AUX_PER_OBJ];
+			AkUInt32 NumValues;
+		} AuxSends;
+
+		AkSoundPosition Position;
+		AkReal32 ScalingFactor;
+		AkUInt32 ListenerMask;
+		AkPlayingID PlayingID;
+	};
+
+	/** Make the sound engine call described by this command */
+	void Execute() const;
+};
+
+/*------------------------------------------------------------------------------------
+	Sound engine command queue
+------------------------------------------------------------------------------------*/
+
+/**
+ * Bounded, lock-free multi-producer / single-consumer ring buffer of FAkAudioCommand.
+ *
+ * Any thread may enqueue commands. The game thread drains the whole queue in one
+ * batch from FAkAudioDevice::Update, right before AK::SoundEngine::RenderAudio.
+ * When the ring buffer is full, commands go to an overflow list, executed right after it, so that
+ * they are never dropped nor executed out of order, and producers never wait for the game thread.
+ */
+class AKAUDIO_API FAkAudioCommandQueue
+{
+public:
+	FAkAudioCommandQueue();
+	~FAkAudioCommandQueue();
+
+	/**
+	 * Allocate the ring buffer and start accepting commands.
+	 *
+	 * @param in_uCapacity		Number of commands the queue can hold. Rounded up to a power of two.
+	 */
+	void Init( uint32 in_uCapacity );
+
+	/**
+	 * Execute all pending commands and release the ring buffer.
+	 */
+	void Term();
+
+	/** Whether commands should be written to this queue instead of being sent to the sound engine right away */
+	bool IsEnabled() const
+	{
+		return Slots != nullptr;
+	}
+
+	/**
+	 * Execute all pending commands, in submission order. Must only be called from the game thread.
+	 *
+	 * @return The number of commands that were executed
+	 */
+	uint32 Flush();
+
+	/** Number of commands that were written to the overflow list */
+	uint32 GetNumOverflows() const
+	{
+		return (uint32)NumOverflows.GetValue();
+	}
+
+	void EnqueuePostEvent( AkUniqueID in_EventID, AkGameObjectID in_GameObjID, AkUInt32 in_uFlags = 0, AkCallbackFunc in_pfnCallback = NULL, void * in_pCookie = NULL );
+	void EnqueuePostTrigger( AkTriggerID in_TriggerID, AkGameObjectID in_GameObjID );
+	void EnqueueSetRTPCValue( AkRtpcID in_RtpcID, AkRtpcValue in_Value, AkGameObjectID in_GameObjID, AkTimeMs in_InterpolationTimeMs );
+	void EnqueueSetSwitch( AkSwitchGroupID in_SwitchGroupID, AkSwitchStateID in_SwitchStateID, AkGameObjectID in_GameObjID );
+	void EnqueueSetState( AkStateGroupID in_StateGroupID, AkStateID in_StateID );
+	void EnqueueSetPosition( AkGameObjectID in_GameObjID, const AkSoundPosition& in_Position );
+	void EnqueueSetAuxSends( AkGameObjectID in_GameObjID, const AkAuxSendValue* in_pAuxSendValues, uint32 in_uNumValues );
+	void EnqueueSetObstructionOcclusion( AkGameObjectID in_GameObjID, AkUInt32 in_ListenerIndex, AkReal32 in_Obstruction, AkReal32 in_Occlusion );
+	void EnqueueSetAttenuationScalingFactor( AkGameObjectID in_GameObjID, AkReal32 in_ScalingFactor );
+	void EnqueueSetActiveListeners( AkGameObjectID in_GameObjID, AkUInt32 in_uListenerMask );
+	void EnqueueStopAll( AkGameObjectID in_GameObjID );
+	void EnqueueStopPlayingID( AkPlayingID in_PlayingID );
+
+private:
+	/** Write a command in the ring buffer, or in the overflow list when it is full or already in use */
+	void Enqueue( const FAkAudioCommand& in_Command );
+
+	/** Write a command in the ring buffer. Returns false when it is full. */
+	bool TryEnqueue( const FAkAudioCommand& in_Command );
+
+	/** Read the oldest command from the ring buffer. Returns false when the buffer is empty. */
+	bool Dequeue( FAkAudioCommand& out_Command );
+
+	struct FSlot
+	{
+		/** Position at which this slot can be written (== position) or read (== position + 1) */
+		volatile int32 Sequence;
+		FAkAudioCommand Command;
+	};
+
+	FSlot* Slots;
+	uint32 Mask;
+
+	/** Producers and consumer positions are kept on separate cache lines */
+	uint8 PadBeforeEnqueue[PLATFORM_CACHE_LINE_SIZE];
+	volatile int32 EnqueuePos;
+	uint8 PadBeforeDequeue[PLATFORM_CACHE_LINE_SIZE];
+	int32 DequeuePos;
+
+	FThreadSafeCounter NumOverflows;
+
+	/** Commands that found the ring buffer full, in submission order */
+	TArray<FAkAudioCommand> OverflowCommands;
+	FCriticalSection OverflowCriticalSection;
+
+	/** Number of commands in OverflowCommands, readable without the lock */
+	FThreadSafeCounter NumPendingOverflows;
+};
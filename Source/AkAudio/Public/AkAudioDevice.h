@@ -14,6 +14,18 @@
 
 #include "AkInclude.h"
 #include "AkBankManager.h"
+#include "AkAudioCommandQueue.h"
+#include "AkCallbackDispatcher.h"
+#include "AkImpactAggregator.h"
+#include "AkOneShotEmitterPool.h"
+#include "AkParameterWriteCombiner.h"
+#include "AkPlayingIDRegistry.h"
+#include "AkPositionBatcher.h"
+#include "AkComponentManager.h"
+#include "AkComponentPool.h"
+#include "AkGameObjectRegistrar.h"
+#include "AkAmbientVirtualizer.h"
+#include "AkCrowdAggregator.h"
 #include "SoundDefinitions.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogAkAudio, Log, All);
@@ -111,6 +123,45 @@ public:
 	 */
 	int32 GetNumListeners() { return m_listenerPositions.Num(); }
 
+	/** Positions of all the listeners */
+	const TArray<FVector>& GetListenerPositions() const { return m_listenerPositions; }
+
+	/**
+	 * Whether an event played at a location would be out of range of every listener, so that it does not need
+	 * to be posted. Always false unless audibility culling is enabled in the settings, for events not classified
+	 * as one-shots, and for events of which the attenuation radius is unknown.
+	 *
+	 * @param in_pEvent						Event about to be posted
+	 * @param in_Location					Location of the emitter
+	 * @param in_fAttenuationScalingFactor	Attenuation scaling factor of the emitter
+	 * @return true if the post can be skipped
+	 */
+	bool IsOutOfAudibleRange( const class UAkAudioEvent * in_pEvent, const FVector& in_Location, float in_fAttenuationScalingFactor );
+
+	/** Number of posts that were tested for audibility culling */
+	uint32 GetNumAudibilityTestedPosts() const { return (uint32)NumAudibilityTestedPosts.GetValue(); }
+
+	/** Number of posts that were skipped because no listener could hear them */
+	uint32 GetNumAudibilityCulledPosts() const { return (uint32)NumAudibilityCulledPosts.GetValue(); }
+
+	/**
+	 * Apply the concurrency rules of an event about to be posted: its minimum re-trigger interval and its
+	 * instance limits. When a limit is reached and the event has a steal policy, an instance is stopped to
+	 * make room for the new one. Must be called from the game thread, right before posting.
+	 *
+	 * @param in_pEvent		Event about to be posted
+	 * @param in_GameObjID	Game object on which it is posted, or AK_INVALID_GAME_OBJECT when it is posted at a location
+	 * @param in_pWorld		World the event plays in. The re-trigger interval is measured in its time, and not applied without one.
+	 * @return false if the post must be skipped
+	 */
+	bool ApplyConcurrencyRules( const class UAkAudioEvent * in_pEvent, AkGameObjectID in_GameObjID, class UWorld * in_pWorld );
+
+	/** Number of posts that were skipped because of the concurrency rules of their event */
+	uint32 GetNumConcurrencyRejectedPosts() const { return (uint32)NumConcurrencyRejectedPosts.GetValue(); }
+
+	/** Number of instances that were stopped to make room for a new one */
+	uint32 GetNumConcurrencyStolenInstances() const { return (uint32)NumConcurrencyStolenInstances.GetValue(); }
+
 	/**
 	 * Stop all audio associated with a scene
 	 *
@@ -242,7 +293,7 @@ public:
 	 * @param in_pfnCallback	Callback function
 	 * @param in_pCookie		Callback cookie that will be sent to the callback function along with additional information.
 	 * @param in_bStopWhenOwnerDestroyed If true, then the sound should be stopped if the owning actor is destroyed
-	 * @return ID assigned by ak soundengine
+	 * @return ID assigned by ak soundengine. Posts made from other threads are made by the game thread on its next update, and return AK_INVALID_PLAYING_ID.
 	 */
 	AkPlayingID PostEvent(
 		class UAkAudioEvent * in_pEvent,
@@ -262,7 +313,7 @@ public:
 	 * @param in_pfnCallback	Callback function
 	 * @param in_pCookie		Callback cookie that will be sent to the callback function along with additional information.
 	 * @param in_bStopWhenOwnerDestroyed If true, then the sound should be stopped if the owning actor is destroyed
-	 * @return ID assigned by ak soundengine
+	 * @return ID assigned by ak soundengine. Posts made from other threads are made by the game thread on its next update, and return AK_INVALID_PLAYING_ID.
 	 */
 	AkPlayingID PostEvent(
 		const FString& in_EventName, 
@@ -278,13 +329,17 @@ public:
 	 *
 	 * @param in_pEvent			Name of the event to post
 	 * @param in_Location		Location at which to play the event
-	 * @return ID assigned by ak soundengine
+	 * @param in_RtpcID			RTPC to set on the emitter before posting, or AK_INVALID_RTPC_ID
+	 * @param in_RtpcValue		Value of that RTPC
+	 * @return ID assigned by ak soundengine. Posts made from other threads are made by the game thread on its next update, and return AK_INVALID_PLAYING_ID.
 	 */
 	AkPlayingID PostEventAtLocation(
 		class UAkAudioEvent * in_pEvent,
 		FVector in_Location,
 		FVector in_Orientation,
-		class UWorld* World
+		class UWorld* World,
+		AkRtpcID in_RtpcID = AK_INVALID_RTPC_ID,
+		AkRtpcValue in_RtpcValue = 0.0f
 		);
 
 	/**
@@ -292,7 +347,7 @@ public:
 	 *
 	 * @param in_pEvent			Name of the event to post
 	 * @param in_Location		Location at which to play the event
-	 * @return ID assigned by ak soundengine
+	 * @return ID assigned by ak soundengine. Posts made from other threads are made by the game thread on its next update, and return AK_INVALID_PLAYING_ID.
 	 */
 	AkPlayingID PostEventAtLocation(
 		const FString& in_EventName,
@@ -322,6 +377,18 @@ public:
 		AActor * in_pActor
 		);
 
+	/**
+	 * Post a trigger to ak soundengine by ID
+	 *
+	 * @param in_TriggerID		ID of the trigger
+	 * @param in_pAkComponent	AkComponent on which to post the trigger
+	 * @return Result from ak sound engine
+	 */
+	AKRESULT PostTrigger( 
+		AkTriggerID in_TriggerID,
+		AActor * in_pActor
+		);
+
 	/**
 	 * Set a RTPC in ak soundengine
 	 *
@@ -338,6 +405,22 @@ public:
 		AActor * in_pActor
 		);
 
+	/**
+	 * Set a RTPC in ak soundengine by ID
+	 *
+	 * @param in_RtpcID			ID of the RTPC
+	 * @param in_value			Value to set
+	 * @param in_interpolationTimeMs - Duration during which the RTPC is interpolated towards in_value (in ms)
+	 * @param in_pActor			AActor on which to set the RTPC
+	 * @return Result from ak sound engine
+	 */
+	AKRESULT SetRTPCValue( 
+		AkRtpcID in_RtpcID,
+		AkRtpcValue in_value,
+		int32 in_interpolationTimeMs,
+		AActor * in_pActor
+		);
+
 	/**
 	 * Set a state in ak soundengine
 	 *
@@ -349,6 +432,18 @@ public:
 		const TCHAR * in_pszStateGroup,
 		const TCHAR * in_pszState
 	    );
+
+	/**
+	 * Set a state in ak soundengine by ID
+	 *
+	 * @param in_StateGroupID	ID of the state group
+	 * @param in_StateID		ID of the state
+	 * @return Result from ak sound engine
+	 */
+	AKRESULT SetState( 
+		AkStateGroupID in_StateGroupID,
+		AkStateID in_StateID
+	    );
 		
 	/**
 	 * Set a switch in ak soundengine
@@ -363,6 +458,37 @@ public:
 		const TCHAR * in_pszSwitchState,
 		AActor * in_pActor
 		);
+
+	/**
+	 * Set a switch in ak soundengine by ID
+	 *
+	 * @param in_SwitchGroupID	ID of the switch group
+	 * @param in_SwitchStateID	ID of the switch
+	 * @param in_pComponent		AkComponent on which to set the switch
+	 * @return Result from ak sound engine
+	 */
+	AKRESULT SetSwitch( 
+		AkSwitchGroupID in_SwitchGroupID,
+		AkSwitchStateID in_SwitchStateID,
+		AActor * in_pActor
+		);
+
+	/**
+	 * Get the Wwise ID of a name. The result is interned, so that only the first lookup of
+	 * a given name hashes it. Safe to call from any thread.
+	 *
+	 * @param in_Name			Name of the Wwise object (event, RTPC, switch, state, trigger...)
+	 * @return The Wwise ID of the object
+	 */
+	static AkUInt32 GetIDFromName( FName in_Name );
+
+	/**
+	 * Get the Wwise ID of a string, hashed the same way the sound engine does.
+	 *
+	 * @param in_pszString		Name of the Wwise object
+	 * @return The Wwise ID of the object
+	 */
+	static AkUInt32 GetIDFromString( const TCHAR * in_pszString );
 		
 	/**
 	 * Sets occlusion and obstruction values for a game object and a listener.
@@ -429,6 +555,7 @@ public:
 	
 	/**
 	 * Get an ak audio component, or create it if none exists that fit the attachment criteria.
+	 * Lookups made without a location are cached per attach component and socket.
 	 */
 	static class UAkComponent* GetAkComponent( 
 		class USceneComponent* AttachToComponent, FName AttachPointName, const FVector * Location, EAttachLocation::Type LocationType );
@@ -664,6 +791,150 @@ public:
 		return MaxAuxBus;
 	}
 
+	/** Whether AkComponents stop updating while no event is playing on them. See UAkComponent::TryEnterDormancy. */
+	bool IsComponentDormancyEnabled() const
+	{
+		return bComponentDormancy;
+	}
+
+	/**
+	 * Queue of deferred sound engine calls, flushed right before audio is rendered. When enabled in the
+	 * settings, game object calls made by the integration (position, RTPC, switch, aux sends, ...) are
+	 * written to it instead of being sent right away. Posts made from the game thread flush it first and
+	 * are sent right away so that their playing ID can be returned; posts from other threads are queued.
+	 */
+	FAkAudioCommandQueue& GetCommandQueue()
+	{
+		return CommandQueue;
+	}
+
+	/**
+	 * Per-frame combiner of RTPC, switch and state writes. When enabled in the settings, these writes
+	 * only keep the latest value per game object and parameter, and are submitted once per frame or
+	 * before the next post, skipping values that did not change.
+	 */
+	FAkParameterWriteCombiner& GetParameterWriteCombiner()
+	{
+		return ParameterWriteCombiner;
+	}
+
+	/**
+	 * Registry of the events playing on each game object. Events posted on a game object by
+	 * the integration are registered in it until their AK_EndOfEvent notification.
+	 */
+	FAkPlayingIDRegistry& GetPlayingIDRegistry()
+	{
+		return PlayingIDRegistry;
+	}
+
+	/**
+	 * Moves sound engine callbacks to the game thread. Handlers registered with it are called
+	 * from Update, before the pending commands are flushed.
+	 */
+	FAkCallbackDispatcher& GetCallbackDispatcher()
+	{
+		return CallbackDispatcher;
+	}
+
+	/**
+	 * Merges the physics impacts reported during a frame. The strongest impacts of each
+	 * bucket are posted at their location from Update.
+	 */
+	FAkImpactAggregator& GetImpactAggregator()
+	{
+		return ImpactAggregator;
+	}
+
+	/**
+	 * Collects the AkComponents that moved during a frame when position batching is enabled.
+	 * Their positions are submitted once from Update.
+	 */
+	FAkPositionBatcher& GetPositionBatcher()
+	{
+		return PositionBatcher;
+	}
+
+	/**
+	 * Updates the AkComponents in place of their tick functions, when centralized component update is enabled.
+	 */
+	FAkComponentManager& GetComponentManager()
+	{
+		return ComponentManager;
+	}
+
+	/**
+	 * Pool of the AkComponents spawned by SpawnAkComponentAtLocation, when a pool size is set. Its stats tell how many spawns it served.
+	 */
+	FAkComponentPool& GetComponentPool()
+	{
+		return ComponentPool;
+	}
+
+	/**
+	 * Registers the game objects of AkComponents on their first use, and unregisters them once idle, when lazy registration is enabled.
+	 */
+	FAkGameObjectRegistrar& GetGameObjectRegistrar()
+	{
+		return GameObjectRegistrar;
+	}
+
+	/**
+	 * Stops the looping events of the AkAmbientSounds out of range of every listener, and restarts them when a listener comes back, when enabled in the settings.
+	 */
+	FAkAmbientVirtualizer& GetAmbientVirtualizer()
+	{
+		return AmbientVirtualizer;
+	}
+
+	/**
+	 * Plays the AkCrowdAgentComponents with one emitter per cell of a grid, except for the agents nearest to a listener. Updated from Update.
+	 */
+	FAkCrowdAggregator& GetCrowdAggregator()
+	{
+		return CrowdAggregator;
+	}
+
+	/**
+	 * Submit the combined parameter writes, then execute the queued sound engine calls. Must only be called from the game thread.
+	 */
+	void FlushPendingCommands();
+
+	/**
+	 * Submit the combined parameter writes of a game object, and the global ones, then execute the queued sound engine calls.
+	 * Used right before a sound engine call made directly on that game object. Must only be called from the game thread.
+	 *
+	 * @param in_GameObjID		Game object about to be used, or AK_INVALID_GAME_OBJECT for the global writes only
+	 */
+	void FlushPendingCommands( AkGameObjectID in_GameObjID );
+
+	/**
+	 * Post an event on a component from a thread other than the game thread. The post is made by the game thread on
+	 * its next update, like any other, so that it wakes the component up, registers its game object and is tracked
+	 * until it ends.
+	 *
+	 * @param in_pComponent			Component to post it on
+	 * @param in_pEvent				Event whose audibility and concurrency rules apply, or NULL when it is posted by ID
+	 * @param in_EventID			Event to post
+	 * @param in_uCallbackFlags		Notifications to broadcast through the component's OnAkEventCallback. See \ref AkCallbackType
+	 */
+	void PostEventFromWorkerThread( class UAkComponent * in_pComponent, class UAkAudioEvent * in_pEvent, AkUniqueID in_EventID, AkUInt32 in_uCallbackFlags = 0 );
+
+	/**
+	 * Destroy an auto destroyed component whose last event ended, or return it to its pool, on the next Update.
+	 * It is kept if an event is posted on it in the meantime. Must only be called from the game thread.
+	 *
+	 * @param in_pComponent		Component flagged for destroy
+	 */
+	void QueueAutoDestroy( class UAkComponent * in_pComponent );
+
+	/**
+	 * Pool of game objects used by PostEventAtLocation.
+	 */
+	const FAkOneShotEmitterPool& GetOneShotEmitterPool() const
+	{
+		return OneShotEmitterPool;
+	}
+
 #if WITH_EDITOR
 	void SetMaxAuxBus(uint8 ValToSet) 
 	{
@@ -688,6 +959,12 @@ public:
 private:
 	bool EnsureInitialized();
 
+	/** Destroy the components queued by QueueAutoDestroy that are still flagged for destroy */
+	void DestroyQueuedComponents();
+
+	/** Make the posts deferred by other threads since the last update */
+	void PostDeferredEvents();
+
 	void SetBankDirectory();
 
 	void* AllocatePermanentMemory( int32 Size, /*OUT*/ bool& AllocatedInPool );
@@ -699,12 +976,68 @@ private:
 		AkCallbackFunc in_pfnCallback /*= NULL*/,
 		void * in_pCookie /*= NULL*/
         );
+
+	AkPlayingID PostEventInternal(
+		AkUniqueID in_EventID, 
+		class UAkComponent* AkComponent, 
+		AkUInt32 in_uFlags /*= 0*/,
+		AkCallbackFunc in_pfnCallback /*= NULL*/,
+		void * in_pCookie /*= NULL*/
+        );
+
+	AkPlayingID PostEventAtLocationInternal(
+		AkUniqueID in_EventID,
+		const TCHAR * in_pszEventName,
+		FVector in_Location,
+		FVector in_Orientation,
+		class UWorld* World,
+		AkRtpcID in_RtpcID = AK_INVALID_RTPC_ID,
+		AkRtpcValue in_RtpcValue = 0.0f
+		);
 		
 	AKRESULT GetGameObjectID(AActor * in_pActor, AkGameObjectID& io_GameObject );
 
 	// Overload allowing to modify StopWhenOwnerDestroyed after getting the AkComponent
 	AKRESULT GetGameObjectID(AActor * in_pActor, AkGameObjectID& io_GameObject, bool in_bStopWhenOwnerDestroyed );
 
+	/**
+	 * Find a registered AkComponent that fits the attachment criteria, without going through the lookup cache.
+	 */
+	static class UAkComponent* FindAkComponent( 
+		class USceneComponent* AttachToComponent, FName AttachPointName, const FVector * Location, EAttachLocation::Type LocationType );
+
+	/**
+	 * Remove the lookups that could resolve to an AkComponent from the GetAkComponent cache
+	 *
+	 * @param in_pComponent		Component being registered or unregistered
+	 */
+	static void InvalidateAkComponentLookup( UAkComponent * in_pComponent );
+
+	/** Attachment criteria of a GetAkComponent lookup */
+	struct FAkComponentLookupKey
+	{
+		const USceneComponent* AttachToComponent;
+		FName AttachPointName;
+
+		FAkComponentLookupKey( const USceneComponent* in_AttachToComponent, FName in_AttachPointName )
+			: AttachToComponent(in_AttachToComponent)
+			, AttachPointName(in_AttachPointName)
+		{}
+
+		bool operator==( const FAkComponentLookupKey& Other ) const
+		{
+			return AttachToComponent == Other.AttachToComponent && AttachPointName == Other.AttachPointName;
+		}
+
+		friend uint32 GetTypeHash( const FAkComponentLookupKey& Key )
+		{
+			return HashCombine( PointerHash(Key.AttachToComponent), GetTypeHash(Key.AttachPointName) );
+		}
+	};
+
+	/** AkComponent found by GetAkComponent for a given attach component and socket. Only used from the game thread. */
+	static TMap< FAkComponentLookupKey, TWeakObjectPtr<UAkComponent> > AkComponentLookupCache;
+
 	static bool m_bSoundEngineInitialized;
 	TArray< FVector > m_listenerPositions;
 
@@ -714,8 +1047,93 @@ private:
 
 	uint8 MaxAuxBus;
 
+	bool bComponentDormancy;
+
+	bool bAudibilityCulling;
+	float AudibilityCullingMargin;
+	FThreadSafeCounter NumAudibilityTestedPosts;
+	FThreadSafeCounter NumAudibilityCulledPosts;
+
+	/** World time of the last post of each event with a re-trigger interval, per game object. Only used from the game thread. */
+	TMap< AkGameObjectID, TMap<AkUniqueID, double> > LastPostTimes;
+	FThreadSafeCounter NumConcurrencyRejectedPosts;
+	FThreadSafeCounter NumConcurrencyStolenInstances;
+
 	FAkBankManager * AkBankManager;
 
+	FAkAudioCommandQueue CommandQueue;
+	FAkParameterWriteCombiner ParameterWriteCombiner;
+	FAkPlayingIDRegistry PlayingIDRegistry;
+	FAkCallbackDispatcher CallbackDispatcher;
+	FAkImpactAggregator ImpactAggregator;
+	FAkPositionBatcher PositionBatcher;
+	FAkComponentManager ComponentManager;
+	FAkComponentPool ComponentPool;
+	FAkGameObjectRegistrar GameObjectRegistrar;
+	FAkAmbientVirtualizer AmbientVirtualizer;
+	FAkCrowdAggregator CrowdAggregator;
+
+	/** Components queued by QueueAutoDestroy. Weak, as they may be destroyed by other means before the next Update. */
+	TArray< TWeakObjectPtr<class UAkComponent> > AutoDestroyQueue;
+	FAkOneShotEmitterPool OneShotEmitterPool;
+
+	/**
+	 * A post made from another thread. The components, the registries, the emitter pool and the reverb volumes
+	 * are only used from the game thread, which makes the post on its next update.
+	 */
+	struct FDeferredPost
+	{
+		enum EType
+		{
+			OnActor,
+			OnComponent,
+			AtLocation
+		};
+
+		EType Type;
+		/** Event posted, or NULL when it is posted by name or by ID */
+		TWeakObjectPtr<class UAkAudioEvent> Event;
+		bool bHasEvent;
+		FString EventName;
+		AkUniqueID EventID;
+		/** Actor or component posted on, or world posted in. Weak, as they may be destroyed in the meantime. */
+		TWeakObjectPtr<UObject> Target;
+		/** Posts without an actor go to the dummy game object */
+		bool bHasTarget;
+		AkUInt32 Flags;
+		AkCallbackFunc Callback;
+		void * Cookie;
+		bool bStopWhenOwnerDestroyed;
+		FVector Location;
+		FVector Orientation;
+		AkRtpcID RtpcID;
+		AkRtpcValue RtpcValue;
+
+		FDeferredPost( EType in_eType, UObject * in_pTarget, class UAkAudioEvent * in_pEvent )
+			: Type(in_eType)
+			, Event(in_pEvent)
+			, bHasEvent(in_pEvent != NULL)
+			, EventID(AK_INVALID_UNIQUE_ID)
+			, Target(in_pTarget)
+			, bHasTarget(in_pTarget != NULL)
+			, Flags(0)
+			, Callback(NULL)
+			, Cookie(NULL)
+			, bStopWhenOwnerDestroyed(false)
+			, Location(FVector::ZeroVector)
+			, Orientation(FVector::ForwardVector)
+			, RtpcID(AK_INVALID_RTPC_ID)
+			, RtpcValue(0.0f)
+		{}
+	};
+
+	/** Add a post made from another thread to the ones made on the next update */
+	void DeferPost( const FDeferredPost& in_Post );
+
+	/** Posts made from other threads since the last update, in submission order */
+	TArray<FDeferredPost> DeferredPosts;
+	FCriticalSection DeferredPostsLock;
+
 #ifdef AK_SOUNDFRAME
 	class AK::SoundFrame::ISoundFrame * m_pSoundFrame;
 #endif
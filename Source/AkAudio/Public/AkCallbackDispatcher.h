@@ -0,0 +1,162 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkCallbackDispatcher.h: Delivery of sound engine callbacks on the game thread.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+#include "AkInclude.h"
+
+/*------------------------------------------------------------------------------------
+	Callback payload
+------------------------------------------------------------------------------------*/
+
+/**
+ * Copy of the information of a sound engine callback, taken on the audio thread.
+ * Only the member of the union matching Type is set.
+ */
+struct FAkCallbackPayload
+{
+	AkCallbackType Type;
+	AkGameObjectID GameObjID;
+	AkPlayingID PlayingID;
+	AkUniqueID EventID;
+
+	/** Handler to which the callback is delivered */
+	uint32 HandlerID;
+
+	union
+	{
+		struct
+		{
+			AkUInt32 Identifier;
+			AkUInt32 Position;
+		} Marker;
+
+		struct
+		{
+			AkReal32 Duration;
+			AkReal32 EstimatedDuration;
+			AkUniqueID AudioNodeID;
+		} Duration;
+
+		struct
+		{
+			AkReal32 BeatDuration;
+			AkReal32 BarDuration;
+			AkReal32 GridDuration;
+			AkReal32 GridOffset;
+		} MusicSync;
+	};
+};
+
+DECLARE_DELEGATE_OneParam( FAkGameThreadCallback, const FAkCallbackPayload& );
+
+/*------------------------------------------------------------------------------------
+	Callback dispatcher
+------------------------------------------------------------------------------------*/
+
+/**
+ * Moves sound engine callbacks to the game thread.
+ *
+ * Events posted with FAkCallbackDispatcher::AudioThreadCallback as their callback, and the
+ * cookie of a registered handler, have their notifications copied into a preallocated,
+ * lock-free multi-producer / single-consumer ring buffer. FAkAudioDevice::Update drains it
+ * once per frame and calls the handlers, so that they can touch UObjects freely.
+ *
+ * When the buffer is full, payloads spill into a locked overflow list rather than being
+ * dropped: handlers relying on AK_EndOfEvent must always get it.
+ */
+class AKAUDIO_API FAkCallbackDispatcher
+{
+public:
+	FAkCallbackDispatcher();
+	~FAkCallbackDispatcher();
+
+	/**
+	 * Allocate the ring buffer.
+	 *
+	 * @param in_uCapacity		Number of payloads the buffer can hold. Rounded up to a power of two.
+	 */
+	void Init( uint32 in_uCapacity );
+
+	/**
+	 * Drop the pending payloads and the handlers, and release the ring buffer.
+	 */
+	void Term();
+
+	/**
+	 * Register a handler. Must only be called from the game thread.
+	 *
+	 * @param in_Handler	Called on the game thread for each notification posted with the returned cookie
+	 * @return Cookie to post events with, along with AudioThreadCallback
+	 */
+	void * RegisterHandler( const FAkGameThreadCallback& in_Handler );
+
+	/**
+	 * Unregister a handler. Its pending payloads are dropped. Must only be called from the game thread.
+	 *
+	 * @param in_pCookie	Cookie returned by RegisterHandler
+	 */
+	void UnregisterHandler( void * in_pCookie );
+
+	/**
+	 * Call the handlers of every pending payload, in the order they were received. Must only be
+	 * called from the game thread. Handlers may post events and register or unregister handlers.
+	 *
+	 * @return The number of payloads that were delivered
+	 */
+	uint32 Dispatch();
+
+	/** Sound engine callback to post events with */
+	static void AudioThreadCallback( AkCallbackType in_eType, AkCallbackInfo* in_pCallbackInfo );
+
+	/** Number of payloads that did not fit in the ring buffer */
+	uint32 GetNumOverflows() const
+	{
+		return (uint32)NumOverflows.GetValue();
+	}
+
+private:
+	void Enqueue( const FAkCallbackPayload& in_Payload );
+	bool Dequeue( FAkCallbackPayload& out_Payload );
+
+	static void * HandlerIDToCookie( uint32 in_HandlerID )
+	{
+		return (void*)(UPTRINT)in_HandlerID;
+	}
+
+	static uint32 CookieToHandlerID( void * in_pCookie )
+	{
+		return (uint32)(UPTRINT)in_pCookie;
+	}
+
+	struct FSlot
+	{
+		/** Position at which this slot can be written (== position) or read (== position + 1) */
+		volatile int32 Sequence;
+		FAkCallbackPayload Payload;
+	};
+
+	FSlot* Slots;
+	uint32 Mask;
+
+	/** Producers and consumer positions are kept on separate cache lines */
+	uint8 PadBeforeEnqueue[PLATFORM_CACHE_LINE_SIZE];
+	volatile int32 EnqueuePos;
+	uint8 PadBeforeDequeue[PLATFORM_CACHE_LINE_SIZE];
+	int32 DequeuePos;
+
+	/** Payloads that did not fit in the ring buffer, delivered after it */
+	FCriticalSection OverflowCriticalSection;
+	TArray<FAkCallbackPayload> OverflowPayloads;
+	FThreadSafeCounter NumPendingOverflows;
+	FThreadSafeCounter NumOverflows;
+
+	/** Only used from the game thread. IDs are never reused, so payloads of an unregistered handler can't reach a new one. */
+	TMap<uint32, FAkGameThreadCallback> Handlers;
+	uint32 NextHandlerID;
+};
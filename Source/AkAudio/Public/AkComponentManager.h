@@ -0,0 +1,265 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkComponentManager.h: Central per-frame update of the AkComponents.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+#include "AkInclude.h"
+
+class UAkComponent;
+
+/*------------------------------------------------------------------------------------
+	Component manager
+------------------------------------------------------------------------------------*/
+
+/**
+ * Updates every registered AkComponent from FAkAudioDevice::Update, one loop per world,
+ * instead of each component running its own tick function.
+ *
+ * The per-frame state needed to decide whether a component has work to do (pending reverb
+ * fades, occlusion fades and refresh time) is kept in arrays indexed
+ * by the component's slot, so that idle components cost a flag and a time test in contiguous
+ * memory. Only the components that have work are touched, through the same functions their
+ * tick used to call.
+ *
+ * Components can also be put in distance LOD tiers. Every frame, the distance from each
+ * component to its closest listener is computed over the positions kept by the manager, and
+ * picks the component's tier. A tier sets minimum intervals between the position, reverb
+ * volume and occlusion updates of its components, so that far components cost less.
+ *
+ * With parallel update, the work of the components is split in phases. The position updates
+ * and the decisions are made on the game thread. The reverb volume and occlusion fades, which
+ * only touch their own component, are then computed in batches on the task graph, into one
+ * work item per component. Finally, the results are sent to the sound engine, and the
+ * occlusion traces made, from the game thread, in slot order.
+ *
+ * Only used from the game thread.
+ */
+class AKAUDIO_API FAkComponentManager
+{
+public:
+	/** Counters since the last call to ResetStats */
+	struct FStats
+	{
+		/** Components visited by the update loops */
+		uint32 NumVisited;
+		/** Components that had work to do */
+		uint32 NumUpdated;
+		/** Components that had work waiting for the interval of their LOD tier */
+		uint32 NumDeferred;
+		/** Batches of fades computed on the task graph */
+		uint32 NumParallelBatches;
+	};
+
+	/** Distance LOD tier. Intervals are in seconds; 0 updates every frame. */
+	struct FLODTier
+	{
+		/** Components up to this distance from their closest listener use this tier, unless a closer tier applies */
+		float MaxDistance;
+		float PositionUpdateInterval;
+		float ReverbUpdateInterval;
+		/** Minimum interval between occlusion refreshes. The component's own interval applies if longer. */
+		float OcclusionRefreshInterval;
+
+		FLODTier()
+			: MaxDistance(0.0f)
+			, PositionUpdateInterval(0.0f)
+			, ReverbUpdateInterval(0.0f)
+			, OcclusionRefreshInterval(0.0f)
+		{}
+	};
+
+	FAkComponentManager();
+
+	/**
+	 * Start managing the components registered from now on.
+	 *
+	 * @param in_LODTiers			Distance LOD tiers, in any order. Components farther than every tier use the farthest one. Leave empty to update every component every frame.
+	 * @param in_bParallelUpdate	Compute the reverb volume and occlusion fades on the task graph
+	 */
+	void Init( const TArray<FLODTier>& in_LODTiers, bool in_bParallelUpdate );
+
+	/**
+	 * Forget every managed component and stop managing new ones. Their tick functions stay disabled.
+	 */
+	void Term();
+
+	/** Whether components should be added to the manager when they are registered */
+	bool IsEnabled() const
+	{
+		return bEnabled;
+	}
+
+	/**
+	 * Start updating a component. Its own tick function must be disabled by the caller.
+	 *
+	 * @param in_pComponent		Registered component. Updated with the world it is registered in.
+	 */
+	void Add( UAkComponent * in_pComponent );
+
+	/** Stop updating a component. Does nothing if it is not managed. */
+	void Remove( UAkComponent * in_pComponent );
+
+	/** Whether a component is updated by the manager */
+	static bool IsManaged( const UAkComponent * in_pComponent );
+
+	/** Apply the reverb volume list of a component on the next update, and until its fades are over */
+	void MarkReverbVolumesDirty( UAkComponent * in_pComponent );
+
+	/**
+	 * Record the new position of a component that moved.
+	 *
+	 * @return true if the LOD tier of the component defers its position update to a later update, false if it must be sent now
+	 */
+	bool OnComponentMoved( UAkComponent * in_pComponent );
+
+	/** Send the position of a component now if it was deferred by its LOD tier. Used before posting an event on it. */
+	void SubmitDeferredPosition( UAkComponent * in_pComponent );
+
+	/**
+	 * Update the components of every world that is not paused. Called once per frame by the device.
+	 *
+	 * @param in_Listeners		Listener positions, used to pick the LOD tiers
+	 * @return The number of components that had work to do
+	 */
+	uint32 Update( const TArray<FVector>& in_Listeners );
+
+	/**
+	 * Update the components of a world.
+	 *
+	 * @param in_pWorld			World of the components
+	 * @param in_fDeltaTime		Time elapsed since the last update, in seconds
+	 * @param in_Listeners		Listener positions, used to pick the LOD tiers
+	 * @return The number of components that had work to do
+	 */
+	uint32 UpdateWorld( UWorld * in_pWorld, float in_fDeltaTime, const TArray<FVector>& in_Listeners );
+
+	/**
+	 * Compute the squared distance from each point to the closest listener, four points at a time.
+	 * The points are given as separate coordinate arrays.
+	 *
+	 * @param in_pX, in_pY, in_pZ		Coordinates of the points
+	 * @param in_iNumPoints				Number of points
+	 * @param in_pListeners				Listener positions
+	 * @param in_iNumListeners			Number of listeners. With none, every distance is MAX_FLT.
+	 * @param out_pDistancesSquared		Filled with in_iNumPoints squared distances
+	 */
+	static void ComputeClosestListenerDistancesSquared( const float * in_pX, const float * in_pY, const float * in_pZ, int32 in_iNumPoints,
+		const FVector * in_pListeners, int32 in_iNumListeners, float * out_pDistancesSquared );
+
+	/** Number of managed components, in every world */
+	int32 GetNumComponents() const;
+
+	FStats GetStats() const
+	{
+		return Stats;
+	}
+
+	void ResetStats()
+	{
+		FMemory::Memzero( Stats );
+	}
+
+private:
+	enum EComponentFlags
+	{
+		/** The reverb volume list changed, or is fading */
+		CF_ReverbVolumes	= 1 << 0,
+		/** The occlusion of a listener is fading */
+		CF_OcclusionFade	= 1 << 1,
+		/** Moved since its position was last sent */
+		CF_Position			= 1 << 2,
+	};
+
+	/** Components of a world, stored as parallel arrays. A component's slot is its index in them. */
+	struct FWorldComponents
+	{
+		TArray<UAkComponent*> Components;
+		TArray<uint8> Flags;
+		/** World time at which the occlusion of the component must be refreshed, or its refresh interval checked again */
+		TArray<float> NextOcclusionTimes;
+
+		/** Position of the component, as of its last transform update */
+		TArray<float> PositionsX;
+		TArray<float> PositionsY;
+		TArray<float> PositionsZ;
+
+		/** LOD tier of the component, and the world times at which its position and reverb volumes were last sent */
+		TArray<uint8> LODTiers;
+		TArray<float> LastPositionTimes;
+		TArray<float> LastReverbTimes;
+	};
+
+	/** Slot of a component in the arrays of its world, or NULL if it is not managed */
+	FWorldComponents * FindWorldComponents( UAkComponent * in_pComponent, int32& out_Slot );
+
+	/** Run the loop over the components of a world */
+	uint32 UpdateComponents( FWorldComponents& in_World, float in_fWorldTime, float in_fDeltaTime, const TArray<FVector>& in_Listeners );
+
+	/** Pick the LOD tier of every component of a world from its distance to the closest listener */
+	void UpdateLODTiers( FWorldComponents& in_World, const TArray<FVector>& in_Listeners );
+
+	/** Work of a component left to the fade and submission phases, and the output of its fades */
+	struct FWorkItem
+	{
+		UAkComponent * Component;
+		int32 Slot;
+		bool bReverbVolumes;
+		bool bOcclusion;
+		/** Time elapsed since the reverb volumes were last applied */
+		float ReverbDeltaTime;
+
+		/** Whether a reverb volume is still fading, and the aux sends to set */
+		bool bReverbFading;
+		TArray<AkAuxSendValue> AuxSends;
+
+		/** Mask of the listeners whose occlusion changed */
+		uint32 FadedListeners;
+	};
+
+	/**
+	 * Do the work flagged in a slot that must run on the game thread, if its LOD tier allows it, and queue
+	 * a work item for its fades. Components without fades are finished right away.
+	 *
+	 * @return false if the work of the component is deferred by its LOD tier
+	 */
+	bool PrepareComponent( FWorldComponents& in_World, int32 in_Slot, float in_fWorldTime, int32 in_iMaxAuxBus );
+
+	/** Advance the fades of a work item. Only touches its component, so that it can run on any thread. */
+	static void ComputeWorkItem( FWorkItem& io_Item, float in_fDeltaTime, int32 in_iMaxAuxBus );
+
+	/** Send the output of a work item to the sound engine, refresh the occlusion if due, and update the flags and times of its slot */
+	void SubmitWorkItem( FWorldComponents& in_World, FWorkItem& in_Item );
+
+	/** Store the flags of a slot, and make its component dormant if it has nothing left to do */
+	void FinishComponent( FWorldComponents& in_World, int32 in_Slot, uint8 in_uFlags );
+
+	/** LOD tier of a slot */
+	const FLODTier& GetLODTier( const FWorldComponents& in_World, int32 in_Slot ) const
+	{
+		return LODTiers.Num() > 0 ? LODTiers[in_World.LODTiers[in_Slot]] : NoLODTier;
+	}
+
+	TMap<UWorld*, FWorldComponents> Worlds;
+
+	/** Sorted by distance. Empty when LOD is disabled, in which case NoLODTier applies to every component. */
+	TArray<FLODTier> LODTiers;
+	TArray<float> LODTierMaxDistancesSquared;
+	FLODTier NoLODTier;
+
+	/** Scratch list, kept between frames to avoid reallocating it */
+	TArray<float> DistancesSquared;
+
+	/** Work items of the current update. Only the first NumWorkItems are used, so that their aux send arrays keep their allocation. */
+	TArray<FWorkItem> WorkItems;
+	int32 NumWorkItems;
+
+	bool bParallelUpdate;
+	bool bEnabled;
+
+	FStats Stats;
+};
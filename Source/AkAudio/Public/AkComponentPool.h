@@ -0,0 +1,108 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkComponentPool.h: Per-world pool of spawned AkComponents.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+class UAkComponent;
+
+/*------------------------------------------------------------------------------------
+	Component pool
+------------------------------------------------------------------------------------*/
+
+/**
+ * Keeps registered, inactive AkComponents around for FAkAudioDevice::SpawnAkComponentAtLocation,
+ * so that spawning an emitter and auto destroying it once its events end do not create and
+ * destroy a UObject each time.
+ *
+ * Every game world gets its pool filled when it is initialized. Components taken from a pool
+ * are returned to it instead of being auto destroyed, as long as the pool is not full. A
+ * returned component gets a fresh game object, so nothing set on it carries over to its
+ * next use.
+ *
+ * Only used from the game thread.
+ */
+class AKAUDIO_API FAkComponentPool
+{
+public:
+	/** Counters since the last call to ResetStats */
+	struct FStats
+	{
+		/** Spawns served by a pooled component */
+		uint32 NumHits;
+		/** Spawns for which a component had to be created */
+		uint32 NumMisses;
+		/** Components returned to their pool */
+		uint32 NumReturned;
+		/** Pooled components destroyed because their pool was full */
+		uint32 NumDiscarded;
+	};
+
+	FAkComponentPool();
+
+	/**
+	 * Start pooling, and fill the pools of the game worlds initialized from now on.
+	 *
+	 * @param in_iPoolSize		Number of components kept per world
+	 */
+	void Init( int32 in_iPoolSize );
+
+	/**
+	 * Forget every pool. The pooled components are destroyed with their world.
+	 */
+	void Term();
+
+	bool IsEnabled() const
+	{
+		return PoolSize > 0;
+	}
+
+	/**
+	 * Get an active component registered in a world, taken from the world's pool if possible.
+	 *
+	 * @param in_pWorld			World in which the component must be registered
+	 * @param in_Location		Location of the component
+	 * @param in_Orientation	Orientation of the component
+	 * @return The component, or NULL if the world has no world settings
+	 */
+	UAkComponent * Acquire( UWorld * in_pWorld, const FVector& in_Location, const FRotator& in_Orientation );
+
+	/**
+	 * Return a component to its world's pool.
+	 *
+	 * @param in_pComponent		Component to return
+	 * @return true if the component was returned; false if it does not come from a pool or the pool is full, in which case it must be destroyed
+	 */
+	bool Release( UAkComponent * in_pComponent );
+
+	/** Number of components waiting in the pool of a world */
+	int32 GetNumPooled( UWorld * in_pWorld ) const;
+
+	FStats GetStats() const
+	{
+		return Stats;
+	}
+
+	void ResetStats()
+	{
+		FMemory::Memzero( Stats );
+	}
+
+private:
+	/** Create a component flagged as pooled, outered to the world settings, and register it */
+	UAkComponent * CreateComponent( UWorld * in_pWorld, bool in_bActivate, const FVector& in_Location, const FRotator& in_Orientation );
+
+	void OnPostWorldInitialization( UWorld * in_pWorld, const UWorld::InitializationValues in_IVS );
+	void OnWorldCleanup( UWorld * in_pWorld, bool in_bSessionEnded, bool in_bCleanupResources );
+
+	/** Inactive components of each world. Weak: they go away with their world settings. */
+	TMap< UWorld*, TArray< TWeakObjectPtr<UAkComponent> > > Pools;
+
+	int32 PoolSize;
+
+	FStats Stats;
+};
@@ -0,0 +1,212 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkCrowdAggregator.h: Grid of aggregate emitters for crowds of agents.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+#include "AkInclude.h"
+
+class FAkAudioDevice;
+class UAkComponent;
+class UAkCrowdAgentComponent;
+
+/*------------------------------------------------------------------------------------
+	Crowd aggregator
+------------------------------------------------------------------------------------*/
+
+/**
+ * Plays the sound of large crowds of agents with one emitter per cell of a uniform grid,
+ * instead of one AkComponent per agent.
+ *
+ * Every frame, the agents are grouped per crowd event, world and cell. Each occupied cell
+ * plays its crowd event on a single AkComponent, moved to the centroid of its agents
+ * weighted by their intensity, with the number of agents set on the density RTPC and the
+ * sum of their intensities on the intensity RTPC. A cell left empty keeps its emitter for
+ * the release delay, with a density of 0, so that agents crossing cell boundaries do not
+ * restart the loop; its event is then stopped, and its emitter destroyed or returned to its
+ * pool once the event ended.
+ *
+ * Only the agents nearest to a listener keep an individual emitter, on which their own
+ * events are posted. They are left out of their cell. The events posted on the other agents
+ * are dropped, their cell standing for them. The cost of a crowd is thus bounded by the
+ * number of occupied cells and of individual agents rather than by the size of the crowd.
+ *
+ * Only used from the game thread.
+ */
+class AKAUDIO_API FAkCrowdAggregator
+{
+public:
+	/** Counters since the last call to ResetStats */
+	struct FStats
+	{
+		/** Cell emitters that started playing their crowd event */
+		uint32 NumCellsStarted;
+		/** Cell emitters stopped after staying empty for the release delay */
+		uint32 NumCellsReleased;
+		/** Events posted on individual agents */
+		uint32 NumAgentEventsPosted;
+		/** Events dropped because their agent was not among the nearest */
+		uint32 NumAgentEventsDropped;
+	};
+
+	FAkCrowdAggregator();
+
+	/**
+	 * Set up the aggregation.
+	 *
+	 * @param in_fCellSize				Size of the grid cells, in game units
+	 * @param in_uMaxIndividualAgents	Number of agents nearest to a listener that keep an individual emitter
+	 * @param in_DensityRtpcID			RTPC set to the number of agents of a cell, or AK_INVALID_RTPC_ID
+	 * @param in_IntensityRtpcID		RTPC set to the sum of the intensities of the agents of a cell, or AK_INVALID_RTPC_ID
+	 * @param in_fReleaseDelay			Time an empty cell keeps its emitter before stopping it, in seconds
+	 */
+	void Init( float in_fCellSize, uint32 in_uMaxIndividualAgents, AkRtpcID in_DensityRtpcID, AkRtpcID in_IntensityRtpcID, float in_fReleaseDelay );
+
+	/**
+	 * Forget the cells and the agents.
+	 */
+	void Term();
+
+	/** Start aggregating an agent. Does nothing if it already is. */
+	void Add( UAkCrowdAgentComponent * in_pAgent );
+
+	/** Stop aggregating an agent. Does nothing if it is not. */
+	void Remove( UAkCrowdAgentComponent * in_pAgent );
+
+	/** Number of agents aggregated */
+	int32 GetNumAgents() const
+	{
+		return Agents.Num();
+	}
+
+	/** Number of cells with an emitter */
+	int32 GetNumCells() const
+	{
+		return Cells.Num();
+	}
+
+	/** Record an event posted on an individual agent, or dropped since its agent is aggregated */
+	void OnAgentEvent( bool in_bPosted )
+	{
+		if( in_bPosted )
+		{
+			Stats.NumAgentEventsPosted++;
+		}
+		else
+		{
+			Stats.NumAgentEventsDropped++;
+		}
+	}
+
+	/**
+	 * Pick the individual agents, then move the cell emitters to the centroids of their agents and set their RTPCs.
+	 * Called once per frame by the device.
+	 *
+	 * @param in_AudioDevice	Device spawning the cell emitters
+	 * @param in_fDeltaTime		Time elapsed since the last update, in seconds
+	 * @param in_Listeners		Listener positions. Without listeners, every agent is aggregated.
+	 * @return The number of cells with an emitter
+	 */
+	uint32 Update( FAkAudioDevice& in_AudioDevice, float in_fDeltaTime, const TArray<FVector>& in_Listeners );
+
+	FStats GetStats() const
+	{
+		return Stats;
+	}
+
+	void ResetStats()
+	{
+		FMemory::Memzero( Stats );
+	}
+
+private:
+	struct FCellKey
+	{
+		const class UAkAudioEvent * Event;
+		const class UWorld * World;
+		int32 X;
+		int32 Y;
+		int32 Z;
+
+		bool operator==( const FCellKey& Other ) const
+		{
+			return Event == Other.Event && World == Other.World && X == Other.X && Y == Other.Y && Z == Other.Z;
+		}
+
+		friend uint32 GetTypeHash( const FCellKey& Key )
+		{
+			return HashCombine( HashCombine( PointerHash( Key.Event ), PointerHash( Key.World ) ),
+				HashCombine( (uint32)Key.X, HashCombine( (uint32)Key.Y, (uint32)Key.Z ) ) );
+		}
+	};
+
+	struct FCell
+	{
+		/** Weak: cells outlive garbage collections and worlds */
+		TWeakObjectPtr<class UAkAudioEvent> Event;
+		TWeakObjectPtr<class UWorld> World;
+		TWeakObjectPtr<UAkComponent> Emitter;
+
+		/** Sums over the agents of the cell this frame */
+		int32 NumAgents;
+		float TotalIntensity;
+		FVector PositionSum;
+		FVector WeightedPositionSum;
+
+		/** Time the cell has been empty, in seconds */
+		float EmptyTime;
+
+		/** Time left before the crowd event is posted again after a failed post, for instance when its instance limit was hit, in seconds */
+		float PostRetryDelay;
+	};
+
+	struct FNearAgent
+	{
+		float DistanceSquared;
+		int32 Index;
+	};
+
+	/** Flag the agents nearest to a listener as individual */
+	void SelectIndividualAgents( const TArray<FVector>& in_Listeners );
+
+	/** Start, move or release the emitter of a cell. Returns false once the cell can be removed. */
+	bool UpdateCell( FCell& in_Cell, FAkAudioDevice& in_AudioDevice, float in_fDeltaTime );
+
+	/** Stop the event of a cell emitter, which is destroyed or returned to its pool once it ends */
+	void ReleaseEmitter( FCell& in_Cell );
+
+	/** Destroy, or return to their pool, the released emitters whose event ended */
+	void ReturnStoppedEmitters();
+
+	/** Remove the agent at an index, moving the last one in its place */
+	void RemoveAt( int32 in_Index );
+
+	/** Aggregated agents. They remove themselves when unregistered. */
+	TArray<UAkCrowdAgentComponent*> Agents;
+
+	/** Agent locations of this frame, kept between frames to avoid reallocating them */
+	TArray<FVector> AgentLocations;
+
+	/** The agents nearest to a listener this frame, unsorted */
+	TArray<FNearAgent> NearAgents;
+
+	TMap<FCellKey, FCell> Cells;
+
+	/**
+	 * Released cell emitters whose event is still stopping. The aggregator owns its emitters until then: they are
+	 * not auto destroyed, as a pooled emitter would stay alive for its cell while being handed out again.
+	 */
+	TArray< TWeakObjectPtr<UAkComponent> > StoppingEmitters;
+
+	float InvCellSize;
+	uint32 MaxIndividualAgents;
+	AkRtpcID DensityRtpcID;
+	AkRtpcID IntensityRtpcID;
+	float ReleaseDelay;
+
+	FStats Stats;
+};
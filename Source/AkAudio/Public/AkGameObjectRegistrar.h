@@ -0,0 +1,132 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkGameObjectRegistrar.h: Lazy registration of AkComponent game objects.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+class UAkComponent;
+
+/*------------------------------------------------------------------------------------
+	Game object registrar
+------------------------------------------------------------------------------------*/
+
+/**
+ * Keeps the game objects of AkComponents registered with the sound engine only while they
+ * are used, when lazy registration is enabled in the settings.
+ *
+ * Components are not registered when their level loads. They stay dormant until an event,
+ * trigger, RTPC or switch is first used on them, which registers their game object and sends
+ * their position, aux sends, active listeners and attenuation scaling factor.
+ *
+ * Once the last event posted on a component ends, its game object is unregistered after the
+ * idle timeout, unless it is used again in the meantime. Events posted on an actor through
+ * the device do not notify the component of their end: the registry is checked again every
+ * timeout until they are over. Components that were given an RTPC or a switch stay registered,
+ * as the sound engine forgets these values with the game object.
+ *
+ * Only used from the game thread.
+ */
+class AKAUDIO_API FAkGameObjectRegistrar
+{
+public:
+	/** Counters since the last call to ResetStats */
+	struct FStats
+	{
+		/** Components left unregistered when they were registered with their world */
+		uint32 NumDeferred;
+		/** Game objects registered when their component was first used */
+		uint32 NumRegistered;
+		/** Game objects unregistered after being idle for the timeout */
+		uint32 NumUnregistered;
+	};
+
+	FAkGameObjectRegistrar();
+
+	/**
+	 * Start registering the game objects of the components registered from now on lazily.
+	 *
+	 * @param in_fIdleTimeout	Time after the end of its last event before a game object is unregistered, in seconds of the time of its world
+	 */
+	void Init( float in_fIdleTimeout );
+
+	/**
+	 * Forget the idle components and stop registering lazily. Game objects that are not registered stay so until they are used.
+	 */
+	void Term();
+
+	/** Whether components should wait for their first use to register their game object */
+	bool IsEnabled() const
+	{
+		return bEnabled;
+	}
+
+	/** Record that a component was left unregistered */
+	void OnRegistrationDeferred()
+	{
+		Stats.NumDeferred++;
+	}
+
+	/** Record that the game object of a component was registered on its first use, and unregister it if it stays idle */
+	void OnRegisteredLazily( UAkComponent * in_pComponent );
+
+	/** Unregister the game object of a component once the idle timeout elapsed, unless it is used or marked idle again before */
+	void MarkIdle( UAkComponent * in_pComponent );
+
+	/**
+	 * Unregister the game objects of the components that stayed idle for the timeout. Called once per frame by the device.
+	 *
+	 * @return The number of game objects that were unregistered
+	 */
+	uint32 Update();
+
+	FStats GetStats() const
+	{
+		return Stats;
+	}
+
+	void ResetStats()
+	{
+		FMemory::Memzero( Stats );
+	}
+
+private:
+	struct FIdleEntry
+	{
+		TWeakObjectPtr<UAkComponent> Component;
+		double ExpiryTime;
+
+		FIdleEntry( UAkComponent * in_pComponent, double in_ExpiryTime )
+			: Component(in_pComponent)
+			, ExpiryTime(in_ExpiryTime)
+		{}
+	};
+
+	/**
+	 * Components of a world marked idle, by increasing expiry time since the timeout is the same for all. Expiry times
+	 * are in the time of the world, so that the timeout stops with pauses and follows time dilation. An entry is stale
+	 * if its component was marked idle again since.
+	 */
+	struct FWorldIdleQueue
+	{
+		TWeakObjectPtr<UWorld> World;
+		TArray<FIdleEntry> Entries;
+	};
+
+	/** Idle queue of the world of a component, added if needed */
+	TArray<FIdleEntry>& GetIdleQueue( UWorld * in_pWorld );
+
+	/** One idle queue per world with idle components. There are few worlds, so they are searched linearly. */
+	TArray<FWorldIdleQueue> IdleQueues;
+
+	/** Scratch array of the expired entries, kept between frames to avoid reallocating it */
+	TArray<FIdleEntry> ExpiredEntries;
+
+	double IdleTimeout;
+	bool bEnabled;
+
+	FStats Stats;
+};
@@ -0,0 +1,129 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkImpactAggregator.h: Per-frame merging of physics impact sounds.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+#include "AkInclude.h"
+
+class FAkAudioDevice;
+
+/*------------------------------------------------------------------------------------
+	Impact aggregator
+------------------------------------------------------------------------------------*/
+
+/**
+ * Collects the impacts reported during a frame into buckets, one per event, world and
+ * cell of a uniform grid. When flushed, only the strongest impacts of each bucket are
+ * posted at their location, with their intensity set on an RTPC; the others are merged
+ * into them. The cost of impact sounds is thus bounded by the number of occupied cells
+ * rather than by the number of contacts.
+ *
+ * Only used from the game thread.
+ */
+class AKAUDIO_API FAkImpactAggregator
+{
+public:
+	/** Counters since the last call to ResetStats */
+	struct FStats
+	{
+		/** Impacts reported */
+		uint32 NumImpacts;
+		/** Impacts that were merged into a stronger one of their bucket */
+		uint32 NumMerged;
+		/** Impacts that were posted */
+		uint32 NumPosted;
+	};
+
+	FAkImpactAggregator();
+
+	/**
+	 * Set up the aggregation.
+	 *
+	 * @param in_fBucketSize			Size of the grid cells, in game units
+	 * @param in_uMaxImpactsPerBucket	Number of impacts posted per bucket and per frame
+	 * @param in_IntensityRtpcID		RTPC set to the intensity of the impact before posting it, or AK_INVALID_RTPC_ID
+	 */
+	void Init( float in_fBucketSize, uint32 in_uMaxImpactsPerBucket, AkRtpcID in_IntensityRtpcID );
+
+	/**
+	 * Drop the pending impacts.
+	 */
+	void Term();
+
+	/**
+	 * Report an impact. It is posted, or merged, on the next Flush.
+	 *
+	 * @param in_pEvent			Event to post for the impact
+	 * @param in_Location		Location of the impact
+	 * @param in_fIntensity		Strength of the impact, in the RTPC's units. Stronger impacts are kept first.
+	 * @param in_pWorld			World in which the impact happened, used for reverb volumes
+	 */
+	void AddImpact( class UAkAudioEvent * in_pEvent, const FVector& in_Location, float in_fIntensity, class UWorld * in_pWorld );
+
+	/**
+	 * Post the strongest impacts of every bucket and forget about the rest. Called once per frame by the device.
+	 *
+	 * @return The number of impacts that were posted
+	 */
+	uint32 Flush( FAkAudioDevice& in_AudioDevice );
+
+	FStats GetStats() const
+	{
+		return Stats;
+	}
+
+	void ResetStats()
+	{
+		FMemory::Memzero( Stats );
+	}
+
+private:
+	struct FBucketKey
+	{
+		const class UAkAudioEvent * Event;
+		const class UWorld * World;
+		int32 X;
+		int32 Y;
+		int32 Z;
+
+		bool operator==( const FBucketKey& Other ) const
+		{
+			return Event == Other.Event && World == Other.World && X == Other.X && Y == Other.Y && Z == Other.Z;
+		}
+
+		friend uint32 GetTypeHash( const FBucketKey& Key )
+		{
+			return HashCombine( HashCombine( PointerHash( Key.Event ), PointerHash( Key.World ) ),
+				HashCombine( (uint32)Key.X, HashCombine( (uint32)Key.Y, (uint32)Key.Z ) ) );
+		}
+	};
+
+	struct FImpact
+	{
+		FVector Location;
+		float Intensity;
+	};
+
+	struct FBucket
+	{
+		/** Weak: the bucket lives until the end of the frame, across a possible garbage collection */
+		TWeakObjectPtr<class UAkAudioEvent> Event;
+		TWeakObjectPtr<class UWorld> World;
+
+		/** The strongest impacts, unsorted */
+		TArray<FImpact, TInlineAllocator<4> > Impacts;
+	};
+
+	TMap<FBucketKey, FBucket> Buckets;
+
+	float InvBucketSize;
+	uint32 MaxImpactsPerBucket;
+	AkRtpcID IntensityRtpcID;
+
+	FStats Stats;
+};
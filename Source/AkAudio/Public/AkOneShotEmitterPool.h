@@ -0,0 +1,103 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkOneShotEmitterPool.h: Recycled game objects for events posted at a location.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+#include "AkInclude.h"
+
+class FAkPlayingIDRegistry;
+
+/** First game object ID used by the one-shot emitters. Component addresses never fall in this range. */
+#define ONESHOT_GAMEOBJ_BASE ((AkGameObjectID)0x100)
+
+/*------------------------------------------------------------------------------------
+	One-shot emitter pool
+------------------------------------------------------------------------------------*/
+
+/**
+ * Fixed set of game objects that are registered once with the sound engine and handed out
+ * to fire-and-forget events posted at a location. An emitter goes back to the pool when the
+ * AK_EndOfEvent callback of the event it was playing is received, so recycling it only
+ * costs a SetPosition and a SetGameObjectAuxSendValues.
+ *
+ * When every emitter is busy, a transient game object with a unique ID is registered for
+ * the event and unregistered right after it is posted.
+ */
+class AKAUDIO_API FAkOneShotEmitterPool
+{
+public:
+	FAkOneShotEmitterPool();
+
+	/**
+	 * Register the emitters with the sound engine.
+	 *
+	 * @param in_uNumEmitters	Number of game objects to keep registered
+	 */
+	void Init( uint32 in_uNumEmitters );
+
+	/**
+	 * Unregister the emitters from the sound engine. The playing ID registry the events were
+	 * posted through must be terminated first, so that no callback comes in afterwards.
+	 */
+	void Term();
+
+	/**
+	 * Post an event on a free emitter placed at the given position.
+	 *
+	 * @param in_PlayingIDRegistry	Registry through which the event is posted, so that it counts towards its concurrency limits
+	 * @param in_EventID			ID of the event to post
+	 * @param in_pszEventName		Name of the event, used to name transient game objects in the profiler
+	 * @param in_Location			Location of the emitter, in world space
+	 * @param in_SoundPosition		Position and orientation of the emitter
+	 * @param in_AuxSendValues		Aux sends of the emitter
+	 * @param in_RtpcID				RTPC to set on the emitter before posting, or AK_INVALID_RTPC_ID
+	 * @param in_RtpcValue			Value of that RTPC
+	 * @return ID assigned by ak soundengine
+	 */
+	AkPlayingID PostEvent(
+		FAkPlayingIDRegistry & in_PlayingIDRegistry,
+		AkUniqueID in_EventID,
+		const TCHAR * in_pszEventName,
+		const FVector & in_Location,
+		const AkSoundPosition & in_SoundPosition,
+		TArray<AkAuxSendValue> & in_AuxSendValues,
+		AkRtpcID in_RtpcID = AK_INVALID_RTPC_ID,
+		AkRtpcValue in_RtpcValue = 0.0f
+		);
+
+	/** Number of emitters currently playing an event */
+	uint32 GetNumActiveEmitters() const
+	{
+		return (uint32)NumActiveEmitters.GetValue();
+	}
+
+	/** Number of events that could not get a pooled emitter and used a transient game object */
+	uint32 GetNumOverflows() const
+	{
+		return (uint32)NumOverflows.GetValue();
+	}
+
+private:
+	static void OneShotEmitterCallback( AkCallbackType in_eType, AkCallbackInfo* in_pCallbackInfo );
+
+	/** Give an emitter back to the pool */
+	void Release( AkGameObjectID in_GameObjID );
+
+	/** Emitters are indexed from ONESHOT_GAMEOBJ_BASE, transient game objects come right after them */
+	uint32 NumEmitters;
+	uint32 NextTransientIndex;
+
+	FCriticalSection FreeEmittersCriticalSection;
+	TArray<uint32> FreeEmitters;
+
+	/** RTPC last set on each emitter, reset before the emitter is reused without it. Only touched by the emitter's current user. */
+	TArray<AkRtpcID> EmitterRtpcs;
+
+	FThreadSafeCounter NumActiveEmitters;
+	FThreadSafeCounter NumOverflows;
+};
@@ -0,0 +1,164 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkParameterWriteCombiner.h: Per-frame coalescing of RTPC, switch and state writes.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+#include "AkInclude.h"
+
+class FAkAudioCommandQueue;
+
+/*------------------------------------------------------------------------------------
+	Parameter write combiner
+------------------------------------------------------------------------------------*/
+
+/**
+ * Keeps the value most recently requested by the game for every (game object, RTPC),
+ * (game object, switch group) and state group, as well as the last value submitted to the
+ * sound engine for every RTPC.
+ *
+ * Requests only overwrite the pending value. On Flush, which happens once per frame, the
+ * pending value is submitted, unless it is an RTPC value closer to the submitted one than
+ * the configured epsilon. Posts and triggers only submit the values of their game object,
+ * the global RTPCs and the states, through FlushGameObject.
+ *
+ * Switches and states are only combined within a frame, and RTPCs only until an event is
+ * posted on their game object: Wwise events change them on their own, through their Set
+ * Switch, Set State, Set Game Parameter and Reset Game Parameter actions.
+ */
+class AKAUDIO_API FAkParameterWriteCombiner
+{
+public:
+	/** Counters since the last call to ResetStats */
+	struct FStats
+	{
+		/** Number of RTPC, switch and state requests received */
+		uint32 NumWrites;
+		/** Requests that were overwritten by a later one before being submitted */
+		uint32 NumCoalesced;
+		/** RTPC requests that were dropped because they did not change the submitted value */
+		uint32 NumDropped;
+		/** Values that were sent to the sound engine */
+		uint32 NumSubmitted;
+	};
+
+	FAkParameterWriteCombiner();
+
+	/**
+	 * Start combining writes.
+	 *
+	 * @param in_fRTPCEpsilon	RTPC changes smaller than or equal to this value are dropped
+	 */
+	void Init( float in_fRTPCEpsilon );
+
+	/**
+	 * Forget all values and stop combining writes. Pending values are not submitted.
+	 */
+	void Term();
+
+	/** Whether writes should go through the combiner */
+	bool IsEnabled() const
+	{
+		return bEnabled;
+	}
+
+	void SetRTPCValue( AkRtpcID in_RtpcID, AkRtpcValue in_Value, AkGameObjectID in_GameObjID, AkTimeMs in_InterpolationTimeMs );
+	void SetSwitch( AkSwitchGroupID in_SwitchGroupID, AkSwitchStateID in_SwitchStateID, AkGameObjectID in_GameObjID );
+	void SetState( AkStateGroupID in_StateGroupID, AkStateID in_StateID );
+
+	/**
+	 * Submit the pending values that changed. Safe to call from any thread.
+	 *
+	 * @param in_CommandQueue	Values are written to this queue when it is enabled, or sent to the sound engine otherwise
+	 * @return The number of values that were submitted
+	 */
+	uint32 Flush( FAkAudioCommandQueue& in_CommandQueue );
+
+	/**
+	 * Submit the pending values of a game object, the pending global RTPCs and the pending states. Used right
+	 * before a post or a trigger, which must see the values requested before it. Safe to call from any thread.
+	 *
+	 * @param in_GameObjID		Game object about to be posted on, or AK_INVALID_GAME_OBJECT for the global values only
+	 * @param in_CommandQueue	Values are written to this queue when it is enabled, or sent to the sound engine otherwise
+	 * @return The number of values that were submitted
+	 */
+	uint32 FlushGameObject( AkGameObjectID in_GameObjID, FAkAudioCommandQueue& in_CommandQueue );
+
+	/**
+	 * Forget the RTPC values submitted for a game object, and the global ones, so that the next writes are
+	 * submitted even if they repeat them. Called when an event is posted on the game object.
+	 *
+	 * @param in_GameObjID		Game object posted on, or AK_INVALID_GAME_OBJECT for the global values only
+	 */
+	void ForgetSubmittedRTPCs( AkGameObjectID in_GameObjID );
+
+	/**
+	 * Drop everything known about a game object. Must be called when the game object is
+	 * registered or unregistered, since the sound engine resets its values.
+	 */
+	void ForgetGameObject( AkGameObjectID in_GameObjID );
+
+	FStats GetStats() const;
+	void ResetStats();
+
+private:
+	struct FRtpcValue
+	{
+		AkRtpcValue SubmittedValue;
+		AkRtpcValue PendingValue;
+		AkTimeMs PendingInterpolationTimeMs;
+		bool bSubmitted;
+		bool bPending;
+	};
+
+	struct FGroupValue
+	{
+		AkUniqueID PendingValue;
+		bool bPending;
+	};
+
+	struct FGameObjectValues
+	{
+		TMap<AkRtpcID, FRtpcValue> Rtpcs;
+		TMap<AkSwitchGroupID, FGroupValue> Switches;
+		/** Whether a value is pending */
+		bool bDirty;
+		/** Whether it is in DirtyGameObjects. It stays there when FlushGameObject submits it. */
+		bool bListed;
+
+		FGameObjectValues()
+			: bDirty(false)
+			, bListed(false)
+		{}
+	};
+
+	/** Record a pending group value. Returns true when it needs to be submitted. */
+	bool SetGroupValue( FGroupValue& io_Value, AkUniqueID in_NewValue, bool in_bNew );
+
+	/** Flag a game object as having a pending value */
+	void MarkDirty( AkGameObjectID in_GameObjID, FGameObjectValues& io_GameObject );
+
+	/** Submit the pending states. Called with the lock held. */
+	uint32 SubmitStates( FAkAudioCommandQueue& in_CommandQueue );
+
+	/** Submit the pending values of a game object. Called with the lock held. */
+	uint32 SubmitGameObject( AkGameObjectID in_GameObjID, FGameObjectValues& io_GameObject, FAkAudioCommandQueue& in_CommandQueue );
+
+	mutable FCriticalSection CombinerCriticalSection;
+
+	TMap<AkGameObjectID, FGameObjectValues> GameObjects;
+	TMap<AkStateGroupID, FGroupValue> States;
+
+	/** Game objects with at least one pending value, and the ones submitted by FlushGameObject since the last Flush */
+	TArray<AkGameObjectID> DirtyGameObjects;
+	bool bStatesDirty;
+
+	float RTPCEpsilon;
+	bool bEnabled;
+
+	FStats Stats;
+};
@@ -0,0 +1,214 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkPlayingIDRegistry.h: Tracking of the events playing on each game object.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+#include "AkInclude.h"
+
+class UAkComponent;
+
+/*------------------------------------------------------------------------------------
+	Playing ID registry
+------------------------------------------------------------------------------------*/
+
+/**
+ * Slot map of the events currently playing, indexed by handle and linked per game object
+ * and per event.
+ *
+ * Events posted through the registry are posted with AK_EndOfEvent added to their callback
+ * flags. The registry's callback releases the slot when the event ends, then forwards the
+ * notification (and every other requested one) to the callback given by the caller, with
+ * the caller's cookie.
+ *
+ * Handles hold a slot index and a generation, so a handle to an event that ended never
+ * resolves to the event that reused its slot. All queries are O(1), except the ones that
+ * walk a game object's or an event's list.
+ */
+class AKAUDIO_API FAkPlayingIDRegistry
+{
+public:
+	/** Reference to a posted event. Stays valid (and inert) after the event ended. */
+	struct FHandle
+	{
+		uint32 Index;
+		uint32 Generation;
+		AkPlayingID PlayingID;
+
+		FHandle()
+			: Index(0)
+			, Generation(0)
+			, PlayingID(AK_INVALID_PLAYING_ID)
+		{}
+
+		bool IsValid() const
+		{
+			return PlayingID != AK_INVALID_PLAYING_ID;
+		}
+	};
+
+	/** How StealInstance picks the instance to stop */
+	enum EStealPolicy
+	{
+		/** The instance that was posted first */
+		StealOldest,
+		/** The instance farthest from its closest listener, relative to its attenuation scaling factor */
+		StealQuietest,
+		/** The instance farthest from its closest listener */
+		StealFarthest
+	};
+
+	FAkPlayingIDRegistry();
+
+	/**
+	 * Cancel the callbacks of every event still registered and forget about them.
+	 */
+	void Term();
+
+	/**
+	 * Post an event and register it. Same parameters as AK::SoundEngine::PostEvent, plus the
+	 * emitter's location and attenuation scaling factor, which are used to pick instances to steal.
+	 *
+	 * @return Handle to the event. Its PlayingID is AK_INVALID_PLAYING_ID if the post failed.
+	 */
+	FHandle PostEvent(
+		AkUniqueID in_EventID,
+		AkGameObjectID in_GameObjID,
+		AkUInt32 in_uFlags = 0,
+		AkCallbackFunc in_pfnCallback = NULL,
+		void * in_pCookie = NULL,
+		const FVector& in_Location = FVector::ZeroVector,
+		float in_fAttenuationScalingFactor = 1.0f
+		);
+
+	/**
+	 * Post an event on the game object of a component and register it. The instances to steal
+	 * are picked from the component's location and attenuation scaling factor at the time they
+	 * are stolen, so that emitters that moved since they were posted are ranked where they are.
+	 *
+	 * @return Handle to the event. Its PlayingID is AK_INVALID_PLAYING_ID if the post failed.
+	 */
+	FHandle PostEvent(
+		AkUniqueID in_EventID,
+		UAkComponent * in_pComponent,
+		AkUInt32 in_uFlags = 0,
+		AkCallbackFunc in_pfnCallback = NULL,
+		void * in_pCookie = NULL
+		);
+
+	/** Whether the event referenced by the handle is still playing */
+	bool IsPlaying( const FHandle& in_Handle ) const;
+
+	/** Playing ID of the event referenced by the handle, or AK_INVALID_PLAYING_ID if it ended */
+	AkPlayingID GetPlayingID( const FHandle& in_Handle ) const;
+
+	/** Number of registered events playing on a game object */
+	uint32 GetNumPlaying( AkGameObjectID in_GameObjID ) const;
+
+	/** Playing IDs of the registered events playing on a game object */
+	void GetPlayingIDs( AkGameObjectID in_GameObjID, TArray<AkPlayingID>& out_PlayingIDs ) const;
+
+	/** Number of registered instances of an event, not counting the ones being stolen */
+	uint32 GetNumInstances( AkUniqueID in_EventID ) const;
+
+	/** Number of registered instances of an event on a game object, not counting the ones being stolen */
+	uint32 GetNumInstances( AkUniqueID in_EventID, AkGameObjectID in_GameObjID ) const;
+
+	/**
+	 * Pick an instance of an event to make room for a new one. The instance is flagged as being
+	 * stolen, so that it is no longer counted nor picked again; stopping it is up to the caller.
+	 * Must only be called from the game thread, as it reads the location of the components.
+	 *
+	 * @param in_EventID		Event of which an instance should be stolen
+	 * @param in_GameObjID		Only consider the instances on this game object, or all of them if AK_INVALID_GAME_OBJECT
+	 * @param in_ePolicy		How the instance is picked
+	 * @param in_Listeners		Listener positions, for the distance based policies
+	 * @return Playing ID of the instance to stop, or AK_INVALID_PLAYING_ID if there is none
+	 */
+	AkPlayingID StealInstance( AkUniqueID in_EventID, AkGameObjectID in_GameObjID, EStealPolicy in_ePolicy, const TArray<FVector>& in_Listeners );
+
+	/**
+	 * Stop forwarding notifications to callers that used this cookie. The events stay
+	 * registered until they end.
+	 */
+	void CancelCookie( void * in_pCookie );
+
+private:
+	static void PlayingIDCallback( AkCallbackType in_eType, AkCallbackInfo* in_pCallbackInfo );
+
+	FHandle PostEventInternal(
+		AkUniqueID in_EventID,
+		AkGameObjectID in_GameObjID,
+		AkUInt32 in_uFlags,
+		AkCallbackFunc in_pfnCallback,
+		void * in_pCookie,
+		const FVector& in_Location,
+		float in_fAttenuationScalingFactor,
+		UAkComponent * in_pComponent
+		);
+
+	struct FSlot
+	{
+		AkPlayingID PlayingID;
+		AkGameObjectID GameObjID;
+		uint32 Generation;
+
+		/** Caller's callback, called for the notifications in Flags */
+		AkCallbackFunc Callback;
+		void * Cookie;
+		AkUInt32 Flags;
+
+		/** Links in the game object's list when in use, in the free list otherwise */
+		int32 Prev;
+		int32 Next;
+
+		/** Links in the event's list */
+		AkUniqueID EventID;
+		int32 EventPrev;
+		int32 EventNext;
+
+		/** Used to pick instances to steal. The location and scaling factor are read from the component when there is one. */
+		double StartTime;
+		FVector Location;
+		float AttenuationScalingFactor;
+		TWeakObjectPtr<UAkComponent> Component;
+
+		bool bInUse;
+		bool bStolen;
+	};
+
+	struct FSlotList
+	{
+		int32 Head;
+		uint32 Num;
+		/** Members that were handed out by StealInstance */
+		uint32 NumStolen;
+	};
+
+	int32 AllocateSlot( AkGameObjectID in_GameObjID, AkUniqueID in_EventID );
+	void ReleaseSlot( int32 in_Index );
+
+	/** The slot index is passed to the sound engine as the cookie. Index 0 is avoided so no cookie is NULL. */
+	static void * IndexToCookie( int32 in_Index )
+	{
+		return (void*)(UPTRINT)( in_Index + 1 );
+	}
+
+	static int32 CookieToIndex( void * in_pCookie )
+	{
+		return (int32)(UPTRINT)in_pCookie - 1;
+	}
+
+	/** Recursive: callbacks may post events */
+	mutable FCriticalSection RegistryCriticalSection;
+
+	TArray<FSlot> Slots;
+	int32 FreeHead;
+
+	TMap<AkGameObjectID, FSlotList> GameObjects;
+	TMap<AkUniqueID, FSlotList> Events;
+};
@@ -0,0 +1,109 @@
+// Copyright (c) 2006-2012 Audiokinetic Inc. / All Rights Reserved
+
+/*=============================================================================
+	AkPositionBatcher.h: Once-per-frame submission of AkComponent positions.
+=============================================================================*/
+
+#pragma once
+
+#include "Engine.h"
+
+#include "AkInclude.h"
+
+class FAkAudioDevice;
+class UAkComponent;
+
+/*------------------------------------------------------------------------------------
+	Position batcher
+------------------------------------------------------------------------------------*/
+
+/**
+ * Collects the AkComponents whose transform changed during a frame, and submits their
+ * positions once, from FAkAudioDevice::Update. A component moved several times in a frame
+ * (e.g. attached to an animated socket) is thus submitted at most once.
+ *
+ * Positions that moved less than the position epsilon, and orientations that turned less
+ * than the orientation epsilon, since they were last submitted are not sent again. The
+ * reverb volumes of a component are only queried again when its position is submitted.
+ *
+ * Only used from the game thread.
+ */
+class AKAUDIO_API FAkPositionBatcher
+{
+public:
+	/** Counters since the last call to ResetStats */
+	struct FStats
+	{
+		/** Transform changes reported */
+		uint32 NumMarked;
+		/** Positions sent to the sound engine */
+		uint32 NumSubmitted;
+		/** Dirty components of which the position did not change enough to be sent */
+		uint32 NumSkipped;
+	};
+
+	FAkPositionBatcher();
+
+	/**
+	 * Start batching position updates.
+	 *
+	 * @param in_fPositionEpsilon			Moves shorter than or equal to this distance, in game units, are not submitted
+	 * @param in_fOrientationEpsilonDegrees	Rotations of the front vector smaller than or equal to this angle are not submitted
+	 */
+	void Init( float in_fPositionEpsilon, float in_fOrientationEpsilonDegrees );
+
+	/**
+	 * Forget the dirty components and stop batching.
+	 */
+	void Term();
+
+	/** Whether position updates should go through the batcher */
+	bool IsEnabled() const
+	{
+		return bEnabled;
+	}
+
+	/** Record that a component's transform changed */
+	void MarkDirty( UAkComponent * in_pComponent );
+
+	/** Forget a component that is being unregistered */
+	void Remove( UAkComponent * in_pComponent );
+
+	/** Submit a component's position right away if it is dirty. Used before posting an event on it. */
+	void SubmitNow( FAkAudioDevice& in_AudioDevice, UAkComponent * in_pComponent );
+
+	/**
+	 * Submit the positions of every dirty component. Called once per frame by the device.
+	 *
+	 * @return The number of positions that were submitted
+	 */
+	uint32 Flush( FAkAudioDevice& in_AudioDevice );
+
+	FStats GetStats() const
+	{
+		return Stats;
+	}
+
+	void ResetStats()
+	{
+		FMemory::Memzero( Stats );
+	}
+
+private:
+	/** Submit the positions of the given dirty components that changed enough, and clear their dirty flag */
+	uint32 Submit( FAkAudioDevice& in_AudioDevice, UAkComponent * const * in_ppComponents, int32 in_NumComponents );
+
+	TArray<UAkComponent*> DirtyComponents;
+
+	/** Scratch arrays, kept between frames to avoid reallocating them */
+	TArray<UAkComponent*> SubmittedComponents;
+	TArray<FVector> Positions;
+	TArray<FVector> Fronts;
+	TArray<AkSoundPosition> SoundPositions;
+
+	float PositionEpsilonSquared;
+	float MinOrientationDot;
+	bool bEnabled;
+
+	FStats Stats;
+};
@@ -13,28 +13,32 @@
 
 #define LOCTEXT_NAMESPACE "AssetTypeActions"
 
-FCriticalSection FAssetTypeActions_AkAudioEvent::m_PlayingAkEventsCriticalSection;
-
-
-static void AkEventPreviewCallback( AkCallbackType in_eType, AkCallbackInfo* in_pCallbackInfo )
+void FAssetTypeActions_AkAudioEvent::HandlePreviewCallback( const FAkCallbackPayload& in_Payload )
 {
-	AkEventCallbackInfo * EventInfo = (AkEventCallbackInfo *)in_pCallbackInfo;
-	TMap<FString, AkPlayingID> * pPlayingAkEvents = (TMap<FString, AkPlayingID> *)EventInfo->pCookie;
-
+	if( in_Payload.Type != AK_EndOfEvent )
 	{
-		FScopeLock Lock(&FAssetTypeActions_AkAudioEvent::m_PlayingAkEventsCriticalSection);
+		return;
+	}
 
-		for(TMap<FString, AkPlayingID>::TConstIterator It(*pPlayingAkEvents); It; ++It)
+	for(TMap<FString, AkPlayingID>::TConstIterator It(m_PlayingAkEvents); It; ++It)
+	{
+		if( It.Value() == in_Payload.PlayingID )
 		{
-			if( It.Value() == EventInfo->playingID )
-			{
-				pPlayingAkEvents->Remove(It.Key());
-				return;
-			}
+			m_PlayingAkEvents.Remove(It.Key());
+			return;
 		}
 	}
 }
 
+void * FAssetTypeActions_AkAudioEvent::GetPreviewCallbackCookie( FAkAudioDevice * AudioDevice )
+{
+	if( m_PreviewCallbackCookie == NULL )
+	{
+		m_PreviewCallbackCookie = AudioDevice->GetCallbackDispatcher().RegisterHandler( FAkGameThreadCallback::CreateSP( this, &FAssetTypeActions_AkAudioEvent::HandlePreviewCallback ) );
+	}
+	return m_PreviewCallbackCookie;
+}
+
 void FAssetTypeActions_AkAudioEvent::GetActions( const TArray<UObject*>& InObjects, FMenuBuilder& MenuBuilder )
 {
 	auto Events = GetTypedWeakObjectPtrs<UAkAudioEvent>(InObjects);
@@ -88,22 +92,17 @@ void FAssetTypeActions_AkAudioEvent::AssetsActivated( const TArray<UObject*>& In
 				FAkAudioDevice * AudioDevice = FAkAudioDevice::Get();
 				if ( AudioDevice )
 				{
-					AkPlayingID* foundID;
-					{
-						FScopeLock Lock(&m_PlayingAkEventsCriticalSection);
-						foundID = m_PlayingAkEvents.Find(pEvent->GetName());
-					}
+					AkPlayingID* foundID = m_PlayingAkEvents.Find(pEvent->GetName());
 					if( foundID != NULL )
 					{
 						AudioDevice->StopPlayingID( *foundID );
 					}
 					else
 					{
-						AkPlayingID CurrentPlayingID = AudioDevice->PostEvent( pEvent, NULL, AK_EndOfEvent, &AkEventPreviewCallback, &m_PlayingAkEvents );
+						AkPlayingID CurrentPlayingID = AudioDevice->PostEvent( pEvent, NULL, AK_EndOfEvent, &FAkCallbackDispatcher::AudioThreadCallback, GetPreviewCallbackCookie( AudioDevice ) );
 						
 						if( CurrentPlayingID != AK_INVALID_PLAYING_ID )
 						{
-							FScopeLock Lock(&m_PlayingAkEventsCriticalSection);
 							AkPlayingID& newPlayingID = m_PlayingAkEvents.FindOrAdd(pEvent->GetName());
 							newPlayingID = CurrentPlayingID;
 						}
@@ -126,22 +125,17 @@ void FAssetTypeActions_AkAudioEvent::PlayEvent(TArray<TWeakObjectPtr<UAkAudioEve
 			UAkAudioEvent * pEvent = (UAkAudioEvent *)(*ObjIt).Get();
 			if ( pEvent )
 			{
-				AkPlayingID* foundID;
-				{
-					FScopeLock Lock(&m_PlayingAkEventsCriticalSection);
-					foundID = m_PlayingAkEvents.Find(pEvent->GetName());
-				}
+				AkPlayingID* foundID = m_PlayingAkEvents.Find(pEvent->GetName());
 				if( foundID != NULL )
 				{
 					AudioDevice->StopPlayingID( *foundID );
 				}
 				else
 				{
-					AkPlayingID CurrentPlayingID = AudioDevice->PostEvent( pEvent, NULL, AK_EndOfEvent, &AkEventPreviewCallback, &m_PlayingAkEvents );
+					AkPlayingID CurrentPlayingID = AudioDevice->PostEvent( pEvent, NULL, AK_EndOfEvent, &FAkCallbackDispatcher::AudioThreadCallback, GetPreviewCallbackCookie( AudioDevice ) );
 
 					if( CurrentPlayingID != AK_INVALID_PLAYING_ID )
 					{
-						FScopeLock Lock(&m_PlayingAkEventsCriticalSection);
 						AkPlayingID& newPlayingID = m_PlayingAkEvents.FindOrAdd(pEvent->GetName());
 						newPlayingID = CurrentPlayingID;
 					}
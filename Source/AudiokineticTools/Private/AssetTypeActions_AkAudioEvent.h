@@ -11,7 +11,7 @@
 class FAssetTypeActions_AkAudioEvent : public FAssetTypeActions_Base
 {
 public:
-	FAssetTypeActions_AkAudioEvent(EAssetTypeCategories::Type InAssetCategory) { MyAssetCategory = InAssetCategory; }
+	FAssetTypeActions_AkAudioEvent(EAssetTypeCategories::Type InAssetCategory) : m_PreviewCallbackCookie(NULL) { MyAssetCategory = InAssetCategory; }
 
 	// IAssetTypeActions Implementation
 	virtual FText GetName() const override { return NSLOCTEXT("AssetTypeActions", "AssetTypeActions_AkAudioEvent", "Audiokinetic Event"); }
@@ -27,9 +27,6 @@ public:
 	virtual void PerformAssetDiff(UObject* OldAsset, UObject* NewAsset, const struct FRevisionInfo& OldRevision, const struct FRevisionInfo& NewRevision) const {}
 	virtual class UThumbnailInfo* GetThumbnailInfo(UObject* Asset) const override { return NULL; };
 
-	// Critical section for accessing the m_PlayingAkEvents map
-	static FCriticalSection		m_PlayingAkEventsCriticalSection;
-
 private:
 	/** Handler for when Play event is selected */
 	void PlayEvent(TArray<TWeakObjectPtr<UAkAudioEvent>> Objects);
@@ -37,9 +34,17 @@ private:
 	/** Handler for when Stop event is selected */
 	void StopEvent(TArray<TWeakObjectPtr<UAkAudioEvent>> Objects);
 
+	/** Removes previewed events from m_PlayingAkEvents when they end. Called on the game thread. */
+	void HandlePreviewCallback( const struct FAkCallbackPayload& in_Payload );
+
+	/** Cookie of HandlePreviewCallback in the callback dispatcher, registered on first use */
+	void * GetPreviewCallbackCookie( class FAkAudioDevice * AudioDevice );
+
 	/** Map containing the Event names and associated Playing IDs related to events currently being previewed */
 	TMap<FString, AkPlayingID>	m_PlayingAkEvents;
 
+	void * m_PreviewCallbackCookie;
+
 	EAssetTypeCategories::Type MyAssetCategory;
 
 };
\ No newline at end of file